@@ -0,0 +1,364 @@
+/// C++ Includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/// Vendor Includes
+#include <aster/aster.hpp>
+#include <catch2/catch_all.hpp>
+
+#ifdef _ASTER_PLATFORM_UNIX
+/// OS Includes
+#include <fnmatch.h>
+#include <glob.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+//  BENCHMARK FIXTURES  //
+
+/// @brief Deterministic Synthetic Directory Tree.
+struct Tree {
+    //  PROPERTIES  //
+
+    /// @brief The temporary root directory.
+    std::filesystem::path root = {};
+
+    /// @brief Number of files generated.
+    size_t files = 0;
+
+    //  CONSTRUCTORS  //
+
+    /**
+     * @brief Generates a tree (the same shape is generated for the same arguments).
+     * @param name              Root directory name (within the temporary directory).
+     * @param depth             Directory nesting depth.
+     * @param fanout            Sub-directories per directory.
+     * @param count             Files per directory.
+     * @param seed              Seed choosing each files extension.
+     */
+    Tree(std::string_view name, size_t depth, size_t fanout, size_t count, uint32_t seed = 42) :
+        root(std::filesystem::temp_directory_path() / name) {
+        std::filesystem::remove_all(root);
+        auto random = std::mt19937(seed);
+        m_generate(root, depth, fanout, count, random);
+    }
+
+    /// @brief Removes the generated tree.
+    ~Tree() { std::filesystem::remove_all(root); }
+
+    //  PUBLIC METHODS  //
+
+    /// @brief Gets walker options rooted at the tree.
+    Aster::Options options() const {
+        auto options = Aster::Options();
+        return options.cwd = root.string(), options;
+    }
+
+   private:
+    //  PRIVATE METHODS  //
+
+    /**
+     * @brief Handles generating a single directory level.
+     * @param directory         Directory to fill.
+     * @param depth             Remaining nesting depth.
+     * @param fanout            Sub-directories per directory.
+     * @param count             Files per directory.
+     * @param random            Extension generator.
+     */
+    void m_generate(const std::filesystem::path& directory, size_t depth, size_t fanout, size_t count,
+                    std::mt19937& random) {
+        static constexpr std::string_view s_extensions[] = { ".cpp", ".hpp", ".md", ".txt", ".json" };
+        std::filesystem::create_directories(directory);
+
+        // files take a seeded extension (so match counts are reproducible)
+        for (size_t index = 0; index < count; ++index, ++files) {
+            auto extension = s_extensions[random() % std::size(s_extensions)];
+            std::ofstream(directory / ("file" + std::to_string(index) + std::string(extension))).put('\n');
+        }
+
+        // and recurse into each sub-directory
+        for (size_t index = 0; depth && index < fanout; ++index) {
+            m_generate(directory / ("dir" + std::to_string(index)), depth - 1, fanout, count, random);
+        }
+    }
+};
+
+/**
+ * @brief Reports the throughput of a contender (its fastest of a few runs, since benchmarks only report times).
+ * @param name              Contender name.
+ * @param bytes             Bytes processed per run.
+ * @param run               Contender to run.
+ * @param runs              Number of runs.
+ */
+template <typename Run>
+void throughput(const std::string& name, size_t bytes, Run&& run, size_t runs = 5) {
+    auto fastest = std::chrono::duration<double>::max();
+    for (size_t index = 0; index < runs; ++index) {
+        auto start = std::chrono::steady_clock::now();
+        auto result = run();
+        fastest = std::min<std::chrono::duration<double>>(fastest, std::chrono::steady_clock::now() - start);
+        Catch::Benchmark::keep_memory(&result);
+    }
+
+    // and report it alongside the benchmark timings
+    WARN(name << ": " << double(bytes) / fastest.count() / 1e9 << " GB/s");
+}
+
+#ifdef _ASTER_PLATFORM_UNIX
+/**
+ * @brief Measures the peak resident memory growth of a contender (in a forked child, so each starts afresh).
+ * @param run               Contender to run.
+ * @returns The growth in bytes (zero if the child failed).
+ */
+template <typename Run>
+size_t peak(Run&& run) {
+    int channel[2] = {};
+    if (::pipe(channel) != 0) return 0;
+
+    // the child reports its own growth (as peaks only ever rise within a process)
+    if (auto child = ::fork(); child == 0) {
+        auto usage = [] {
+            auto current = ::rusage();
+            ::getrusage(RUSAGE_SELF, &current);
+#ifdef __APPLE__
+            return size_t(current.ru_maxrss);  // reported in bytes
+#else
+            return size_t(current.ru_maxrss) << 10;  // reported in kilobytes
+#endif
+        };
+        auto before = usage();
+        run();
+        auto growth = usage() - before;
+        ::_exit(::write(channel[1], &growth, sizeof(growth)) == sizeof(growth) ? 0 : 1);
+    } else {
+        size_t growth = 0;
+        if (child < 0 || ::read(channel[0], &growth, sizeof(growth)) != sizeof(growth)) growth = 0;
+        if (child > 0) ::waitpid(child, nullptr, 0);
+        return ::close(channel[0]), ::close(channel[1]), growth;
+    }
+}
+#endif
+
+//  BENCHMARK CASES  //
+
+TEST_CASE("Match") {
+    // realistic globs along with pathological backtracking cases
+    auto corpus = std::vector<std::pair<std::string, std::string>> {
+        { "**/*.cpp", "some/deeply/nested/source/directory/file.cpp" },
+        { "src/**/test_*.{c,h}pp", "src/module/nested/test_parser.hpp" },
+        { "*.md", "README.md" },
+        { "**/node_modules/**/*.js", "packages/app/node_modules/lodash/fp/map.js" },
+        { "[a-z]*/[!_]*.{json,yaml,yml}", "config/settings.yaml" },
+        { "a*a*a*a*a*a*a*a*b", std::string(64, 'a') },
+        { "**/**/**/**/x", "a/b/c/d/e/f/g/h/i/j/k/l/m/n/o/p" },
+        { "{a,{b,{c,{d,{e,f}}}}}*{g,h}?", "feeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeh" },
+    };
+
+    for (const auto& [glob, input] : corpus) {
+        BENCHMARK("Match::glob " + glob) { return Aster::Match::glob(glob, input); };
+        BENCHMARK("Match::linear " + glob) { return Aster::Match::linear(glob, input); };
+        BENCHMARK("Compile::pattern " + glob) { return Aster::Detail::Compile().pattern(glob); };
+    }
+
+    // the specialised matchers picked for literal and extension-only globs
+    auto literal = std::string("src/aster/include/aster/pattern.hpp");
+    BENCHMARK("Match::exact") { return Aster::Match::exact(literal, literal); };
+    BENCHMARK("Match::extends") { return Aster::Match::extends("**/*.hpp", literal); };
+
+#ifdef _ASTER_PLATFORM_UNIX
+    // compared against the C library matcher (which lacks globstars and braces)
+    BENCHMARK("fnmatch *.md") { return ::fnmatch("*.md", "README.md", FNM_PATHNAME); };
+    BENCHMARK("fnmatch a*a*a*a*a*a*a*a*b") { return ::fnmatch("a*a*a*a*a*a*a*a*b", corpus[5].second.c_str(), 0); };
+#endif
+}
+
+TEST_CASE("Walk") {
+    // a wide shallow tree and a narrow deep tree of roughly the same size
+    auto wide = Tree("aster-benchmarks-wide", 2, 24, 16);
+    auto deep = Tree("aster-benchmarks-deep", 8, 2, 16);
+
+    for (const auto* tree : { &wide, &deep }) {
+        auto options = tree->options();
+        auto name = tree->root.filename().string();
+
+        // pre-ensure every contender agrees on the matches
+        auto expected = size_t(0);
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(tree->root)) {
+            expected += entry.is_regular_file() && entry.path().extension() == ".cpp";
+        }
+        CHECK(Aster::Walker("**/*.cpp").count(options) == expected);
+
+        // and then coordinate running benchmarks
+        BENCHMARK("Aster::Walker **/*.cpp " + name) { return Aster::Walker("**/*.cpp").count(options); };
+        BENCHMARK("Aster::Walker */*/*.cpp " + name) { return Aster::Walker("*/*/*.cpp").count(options); };
+        BENCHMARK("Aster::Walker **/*.cpp io_uring " + name) {
+            return Aster::Walker("**/*.cpp").count(options, Aster::Uring());
+        };
+        BENCHMARK("Aster::Walker::parallel_for_each **/*.cpp " + name) {
+            auto count = std::atomic<size_t>(0);
+            Aster::Walker("**/*.cpp").parallel_for_each(options, [&](const Aster::Entry&) { ++count; });
+            return count.load();
+        };
+
+        // the standard library walk (filtering by extension only)
+        BENCHMARK("recursive_directory_iterator " + name) {
+            size_t count = 0;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(tree->root)) {
+                count += entry.is_regular_file() && entry.path().extension() == ".cpp";
+            }
+            return count;
+        };
+
+#ifdef _ASTER_PLATFORM_UNIX
+        // the standard library walk matched through the C library
+        BENCHMARK("recursive_directory_iterator + fnmatch " + name) {
+            size_t count = 0, prefix = tree->root.string().size() + 1;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(tree->root)) {
+                auto path = entry.path().string().substr(prefix);
+                count += entry.is_regular_file() && ::fnmatch("*/*/*.cpp", path.c_str(), FNM_PATHNAME) == 0;
+            }
+            return count;
+        };
+
+        // and the C library glob (fixed depth only, since it has no globstar)
+        BENCHMARK("glob(3) */*/*.cpp " + name) {
+            auto results = ::glob_t();
+            auto pattern = (tree->root / "*/*/*.cpp").string();
+            auto count = ::glob(pattern.c_str(), 0, nullptr, &results) == 0 ? results.gl_pathc : 0;
+            return ::globfree(&results), count;
+        };
+#endif
+    }
+}
+
+#ifdef _ASTER_PLATFORM_UNIX
+TEST_CASE("Pending") {
+    // the directories queued whilst listing a single directory 10M entries wide
+    static constexpr size_t s_siblings = 10'000'000;
+    auto root = (std::filesystem::temp_directory_path() / "aster-benchmarks-pending").string();
+    auto child = [&](size_t index) { return root + "/directory" + std::to_string(index); };
+
+    // queueing full path strings (as walks did before `Detail::Pending`)
+    auto strings = peak([&] {
+        auto pending = std::vector<std::string>();
+        for (size_t index = 0; index < s_siblings; ++index) pending.push_back(child(index));
+        Catch::Benchmark::keep_memory(&pending);
+    });
+
+    // against queueing names in a shared arena
+    auto arena = peak([&] {
+        auto pending = Aster::Detail::Pending(root);
+        pending.pop();
+        for (size_t index = 0; index < s_siblings; ++index) pending.push(child(index));
+        Catch::Benchmark::keep_memory(&pending);
+    });
+
+    WARN("std::vector<std::string> 10M siblings peak RSS: +" << (strings >> 20) << "MB");
+    WARN("Aster::Detail::Pending 10M siblings peak RSS: +" << (arena >> 20) << "MB");
+    CHECK(arena < strings);
+}
+#endif
+
+TEST_CASE("Index") {
+    auto tree = Tree("aster-benchmarks-index", 4, 6, 8);
+    auto index = Aster::Index(Aster::Walker("**"), tree.options());
+
+    BENCHMARK("Aster::Index::count **/*.cpp") { return index.count("**/*.cpp"); };
+    BENCHMARK("Aster::Index::count dir0/dir1/*") { return index.count("dir0/dir1/*"); };
+}
+
+TEST_CASE("Incremental") {
+    auto random = std::mt19937(42);
+
+    // sorted paths sharing long directory prefixes (as listed by `git ls-files`)
+    auto paths = std::vector<std::string>();
+    for (size_t index = 0; index < 200'000; ++index) {
+        paths.push_back("packages/module" + std::to_string(random() % 64) + "/source/nested/directory" +
+                        std::to_string(random() % 16) + "/file" + std::to_string(index) + ".cpp");
+    }
+    std::ranges::sort(paths);
+
+    for (auto glob : { "**/*.cpp", "packages/module1/**/*.cpp" }) {
+        auto pattern = Aster::Pattern(glob);
+        BENCHMARK("Pattern::matches " + std::string(glob)) {
+            return std::ranges::count_if(paths, [&](const std::string& path) { return pattern.matches(path); });
+        };
+
+        BENCHMARK("Aster::Incremental " + std::string(glob)) {
+            auto matcher = Aster::Incremental(pattern);
+            size_t count = 0;
+            for (size_t index = 0; index < paths.size(); index = matcher.skip(paths, index + 1)) {
+                count += matcher.matches(paths[index]);
+            }
+            return count;
+        };
+    }
+}
+
+TEST_CASE("Manifest") {
+    auto file = std::filesystem::temp_directory_path() / "aster-benchmarks-manifest.txt";
+    auto random = std::mt19937(42);
+
+    // a newline-delimited manifest of roughly 80MB (each contender reports its throughput too)
+    {
+        static constexpr std::string_view s_extensions[] = { ".cpp", ".hpp", ".md", ".txt", ".json" };
+        auto output = std::ofstream(file, std::ios::binary);
+        for (size_t index = 0; index < 1'500'000; ++index) {
+            output << "packages/module" << random() % 64 << "/source/nested/directory/file" << index
+                   << s_extensions[random() % std::size(s_extensions)] << '\n';
+        }
+    }
+
+    auto bytes = size_t(std::filesystem::file_size(file));
+    auto size = std::to_string(bytes >> 20) + "MB";
+    auto manifest = Aster::Manifest(file.string());
+    auto pattern = Aster::Pattern("**/*.cpp");
+
+    // reading line by line into strings (the single-core baseline)
+    auto getline = [&] {
+        auto input = std::ifstream(file, std::ios::binary);
+        size_t count = 0;
+        for (std::string line; std::getline(input, line);) count += pattern.matches(line);
+        return count;
+    };
+
+    auto contenders = std::vector<std::pair<std::string, std::function<size_t()>>> {
+        { "Aster::Manifest 1 thread", [&] { return manifest.count(pattern, 1); } },
+        { "Aster::Manifest all threads", [&] { return manifest.count(pattern); } },
+        { "getline + Pattern::matches", getline },
+    };
+
+#ifdef _ASTER_PLATFORM_UNIX
+    // and the grep-style tools (timed through the shell, so including process startup)
+    auto counted = file.string() + ".count";  // grep stops at the first match when writing to /dev/null
+    auto command = "grep -c '\\.cpp$' " + file.string() + " > " + counted;
+    contenders.emplace_back("grep -c (with process startup)", [&] { return size_t(std::system(command.c_str())); });
+#endif
+
+    for (const auto& [name, run] : contenders) {
+        BENCHMARK(name + " " + size) { return run(); };
+        throughput(name + " " + size, bytes, run);
+    }
+
+#ifdef _ASTER_PLATFORM_UNIX
+    std::filesystem::remove(counted);
+#endif
+
+    std::filesystem::remove(file);
+}
+
+//  BENCHMARK RUNNER  //
+
+/// @brief Handles entry for benchmarking (`--reporter JSON::out=<file>` for machine-readable results).
+int32_t main(int32_t argc, char** argv) { return Catch::Session().run(argc, argv); }
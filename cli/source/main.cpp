@@ -0,0 +1,300 @@
+/// C++ Includes
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+/// Vendor Includes
+#include <aster/aster.hpp>
+
+//  COMMAND LINE  //
+
+/// @brief Usage text.
+static constexpr std::string_view s_usage = R"(usage: aster [options] [glob...]
+
+Prints every path below the working directory matching any glob ("**/*" when none are given).
+
+options:
+  -e, --exclude <glob>   skip paths matching a glob (and prune matching directories)
+  -C, --cwd <dir>        walk from a directory (the current directory by default)
+  -H, --hidden           match (and descend) hidden entries
+  -L, --symlinks         match symlinks
+  -d, --directories      match directories
+  -D, --no-files         do not match files
+  -s, --sort             print in sorted path order (walks on a single thread)
+  -j, --threads <n>      walk top-level directories on n threads (hardware concurrency when 0)
+  -0, --null             separate paths with NUL instead of newlines
+  -c, --count            print the number of matches only
+  -q, --exists           print nothing, exiting with 0 once any path matches (1 otherwise)
+  -h, --help             print this help
+)";
+
+/// @brief Parsed Command Line Arguments.
+struct Arguments {
+    //  PROPERTIES  //
+
+    std::vector<Aster::Pattern> globs = {};     // Globs to match.
+    std::vector<Aster::Pattern> excludes = {};  // Globs to skip.
+    Aster::Options options = {};                // Walk options.
+    size_t threads = 1;                         // Walking threads.
+    char delimiter = '\n';                      // Path delimiter.
+    bool count = false;                         // Print the number of matches only.
+    bool exists = false;                        // Only report if any path matched.
+};
+
+/// @brief Buffered Path Writer (flushing large blocks of whole paths to stdout).
+class Output {
+    //  PROPERTIES  //
+
+    /// @brief Serializes flushes across threads (so paths never interleave).
+    static inline std::mutex s_mutex = {};
+
+    /// @brief Block size to flush at.
+    static constexpr size_t s_block = size_t(1) << 20;
+
+    /// @brief Buffered paths.
+    std::string m_buffer = {};
+
+    /// @brief Path delimiter.
+    char m_delimiter = '\n';
+
+   public:
+    //  CONSTRUCTORS  //
+
+    /**
+     * @brief Constructs an empty writer.
+     * @param delimiter         Path delimiter.
+     */
+    explicit Output(char delimiter) : m_delimiter(delimiter) { m_buffer.reserve(s_block + 4096); }
+
+    Output(const Output&) = delete;
+
+    /// @brief Flushes any remaining paths.
+    ~Output() { flush(); }
+
+    //  PUBLIC METHODS  //
+
+    /**
+     * @brief Writes a path (flushing once the block is full).
+     * @param path              Path to write.
+     */
+    void write(std::string_view path) {
+        m_buffer.append(path).push_back(m_delimiter);
+        if (m_buffer.size() >= s_block) flush();
+    }
+
+    /// @brief Flushes the buffered paths.
+    void flush() {
+        if (m_buffer.empty()) return;
+        auto lock = std::scoped_lock(s_mutex);
+        std::fwrite(m_buffer.data(), 1, m_buffer.size(), stdout), m_buffer.clear();
+    }
+};
+
+/// @brief Concurrent Walk Driver.
+class Driver {
+    //  PROPERTIES  //
+
+    /// @brief Parsed arguments.
+    const Arguments& m_arguments;
+
+    /// @brief Filter applying the globs with the requested options.
+    Aster::Detail::Filter m_filter;
+
+    /// @brief Exclusion filter (matching every entry type).
+    Aster::Detail::Filter m_excluded;
+
+    /// @brief Total matches.
+    std::atomic<uint64_t> m_matches = 0;
+
+    /// @brief Denotes if the walk should stop (when only checking existence).
+    std::atomic<bool> m_stopped = false;
+
+   public:
+    //  CONSTRUCTORS  //
+
+    /**
+     * @brief Constructs a walk driver.
+     * @param arguments         Parsed arguments.
+     */
+    explicit Driver(const Arguments& arguments) :
+        m_arguments(arguments), m_filter(arguments.globs, arguments.options),
+        m_excluded(arguments.excludes, m_permissive(arguments.options)) {}
+
+    //  PUBLIC METHODS  //
+
+    /// @brief Runs the walk (returning the number of matches).
+    uint64_t run() {
+        // single-threaded walks take the library walk as-is (unless pruning exclusions)
+        auto& arguments = m_arguments;
+        if (arguments.threads <= 1) {
+            auto output = Output(arguments.delimiter);
+            if (arguments.excludes.size()) return m_walk(arguments.options.cwd, output), m_matches.load();
+            Aster::MultiWalker(arguments.globs).visit(arguments.options, [&](const Aster::Entry& entry) {
+                return m_emit(entry, output);
+            });
+
+            return m_matches;
+        }
+
+        // otherwise list the working directory, queueing every top-level directory that may contain matches
+        auto tasks = std::vector<std::string>();
+        {
+            auto output = Output(arguments.delimiter);
+            auto options = m_permissive(arguments.options);
+            Aster::Walker("*").visit(options, [&](const Aster::Entry& entry) {
+                if (m_excluded.test(entry)) return Aster::Visit::CONTINUE;
+                if (entry.type == Aster::Archetype::DIRECTORY && m_filter.descends(entry.path)) {
+                    tasks.push_back(entry.path);
+                }
+
+                // and emit the top-level entry itself (if matching)
+                return m_filter.test(entry) ? m_emit(entry, output) : Aster::Visit::CONTINUE;
+            });
+        }
+
+        // the top-level directories are then walked by each thread in turn
+        auto next = std::atomic<size_t>(0);
+        auto work = [&] {
+            auto output = Output(arguments.delimiter);
+            for (auto index = next++; index < tasks.size() && !m_stopped; index = next++) m_walk(tasks[index], output);
+        };
+
+        auto workers = std::vector<std::jthread>();
+        for (size_t index = 1; index < std::min(arguments.threads, tasks.size()); ++index) workers.emplace_back(work);
+        work(), workers.clear();
+
+        // resolve the total matches
+        return m_matches;
+    }
+
+   private:
+    //  PRIVATE METHODS  //
+
+    /**
+     * @brief Handles walking within a directory.
+     * @param directory         Directory path (the working directory, or prefixed by it).
+     * @param output            Writer to emit into.
+     */
+    void m_walk(const std::string& directory, Output& output) {
+        auto options = m_permissive(m_arguments.options);
+        options.cwd = directory;
+
+        // every entry is visited, pruning directories the globs cannot descend into
+        Aster::Walker("**").visit(options, [&](const Aster::Entry& entry) {
+            if (m_stopped) return Aster::Visit::STOP;
+            if (m_excluded.test(entry)) return Aster::Visit::SKIP;
+
+            // emit any matches before pruning their contents
+            auto pruned = entry.type == Aster::Archetype::DIRECTORY && !m_filter.descends(entry.path);
+            auto action = m_filter.test(entry) ? m_emit(entry, output) : Aster::Visit::CONTINUE;
+            return pruned && action == Aster::Visit::CONTINUE ? Aster::Visit::SKIP : action;
+        });
+    }
+
+    /**
+     * @brief Handles emitting a match.
+     * @param entry             Matched entry.
+     * @param output            Writer to emit into.
+     */
+    Aster::Visit m_emit(const Aster::Entry& entry, Output& output) {
+        m_matches += 1;
+        if (m_arguments.exists) return m_stopped = true, Aster::Visit::STOP;
+        if (m_arguments.count) return Aster::Visit::CONTINUE;
+
+        // paths are printed relative to the working directory (unless outside of it)
+        auto path = std::string_view(entry.path);
+        auto& cwd = m_arguments.options.cwd;
+        if (path.size() > cwd.size() && path.starts_with(cwd)) path.remove_prefix(cwd.size() + 1);
+        return output.write(path), Aster::Visit::CONTINUE;
+    }
+
+    /**
+     * @brief Gets options listing every entry (so filtering is left to the visitors).
+     * @param options           Requested options.
+     */
+    static Aster::Options m_permissive(Aster::Options options) {
+        options.files = options.hidden = options.symlinks = options.directories = true;
+        return options;
+    }
+};
+
+/**
+ * @brief Parses the command line.
+ * @param argc              Argument count.
+ * @param argv              Argument values.
+ * @param arguments         Arguments to fill.
+ * @returns An error message (empty on success).
+ */
+static std::string parse(int32_t argc, char** argv, Arguments& arguments) {
+    auto& options = arguments.options;
+    auto globs = std::vector<std::string>();
+    for (int32_t index = 1; index < argc; ++index) {
+        auto argument = std::string_view(argv[index]);
+        auto value = [&]() -> const char* { return index + 1 < argc ? argv[++index] : nullptr; };
+
+        // handle each flag (anything else is a glob)
+        if (argument == "-h" || argument == "--help") return "help";
+        else if (argument == "-H" || argument == "--hidden") options.hidden = true;
+        else if (argument == "-L" || argument == "--symlinks") options.symlinks = true;
+        else if (argument == "-d" || argument == "--directories") options.directories = true;
+        else if (argument == "-D" || argument == "--no-files") options.files = false;
+        else if (argument == "-s" || argument == "--sort") options.sorting = Aster::Sorting::BYTEWISE;
+        else if (argument == "-0" || argument == "--null") arguments.delimiter = '\0';
+        else if (argument == "-c" || argument == "--count") arguments.count = true;
+        else if (argument == "-q" || argument == "--exists") arguments.exists = true;
+        else if (argument == "-e" || argument == "--exclude") {
+            auto glob = value();
+            if (glob == nullptr) return "missing glob for " + std::string(argument);
+            arguments.excludes.emplace_back(std::string(glob));
+        } else if (argument == "-C" || argument == "--cwd") {
+            auto directory = value();
+            if (directory == nullptr) return "missing directory for " + std::string(argument);
+            options.cwd = std::filesystem::absolute(directory).lexically_normal().string();
+            while (options.cwd.size() > 1 && options.cwd.ends_with('/')) options.cwd.pop_back();
+        } else if (argument == "-j" || argument == "--threads") {
+            auto text = value();
+            auto count = std::string_view(text ? text : "");
+            auto parsed = std::from_chars(count.data(), count.data() + count.size(), arguments.threads);
+            if (count.empty() || parsed.ec != std::errc()) return "invalid thread count for " + std::string(argument);
+            if (arguments.threads == 0) arguments.threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        } else if (argument.starts_with('-') && argument.size() > 1) return "unknown option " + std::string(argument);
+        else globs.emplace_back(argument);
+    }
+
+    // walk everything when no globs were given
+    if (globs.empty()) globs.emplace_back("**/*");
+    if (globs.size() > Aster::Detail::capacity() || arguments.excludes.size() > Aster::Detail::capacity()) {
+        return "too many globs (at most " + std::to_string(Aster::Detail::capacity()) + ")";
+    }
+
+    // sorted (and absolute) walks stay on a single thread
+    for (const auto& glob : globs) arguments.globs.emplace_back(glob);
+    auto absolute = std::ranges::any_of(arguments.globs, &Aster::Pattern::absolute);
+    if (options.sorting != Aster::Sorting::NONE || absolute) arguments.threads = 1;
+    return "";
+}
+
+//  COMMAND RUNNER  //
+
+/// @brief Handles entry for the command line tool.
+int32_t main(int32_t argc, char** argv) {
+    auto arguments = Arguments();
+    if (auto error = parse(argc, argv, arguments); error == "help") {
+        return std::fwrite(s_usage.data(), 1, s_usage.size(), stdout), 0;
+    } else if (error.size()) {
+        return std::fprintf(stderr, "aster: %s\n\n%s", error.c_str(), s_usage.data()), 2;
+    }
+
+    // walk (with paths flushed as each writer finishes)
+    auto matches = Driver(arguments).run();
+    if (arguments.count) std::printf("%llu\n", static_cast<unsigned long long>(matches));
+    return arguments.exists && matches == 0 ? 1 : 0;
+}
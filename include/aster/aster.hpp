@@ -2,12 +2,30 @@
 #define _ASTER_LIBRARY_HPP
 
 /// Aster Includes
+#include "aster/async.hpp"
+#include "aster/backend.hpp"
+#include "aster/cache.hpp"
+#include "aster/channel.hpp"
 #include "aster/compile.hpp"
+#include "aster/content.hpp"
 #include "aster/entry.hpp"
+#include "aster/incremental.hpp"
+#include "aster/index.hpp"
 #include "aster/iterator.hpp"
+#include "aster/manifest.hpp"
 #include "aster/match.hpp"
+#include "aster/memory.hpp"
+#include "aster/optimizer.hpp"
+#include "aster/options.hpp"
+#include "aster/parallel.hpp"
 #include "aster/pattern.hpp"
 #include "aster/slice.hpp"
+#include "aster/snapshot.hpp"
+#include "aster/statistics.hpp"
+#include "aster/tar.hpp"
+#include "aster/trace.hpp"
+#include "aster/uring.hpp"
 #include "aster/walker.hpp"
+#include "aster/watcher.hpp"
 
 #endif
@@ -0,0 +1,223 @@
+#ifndef _ASTER_ASYNC_HPP
+#define _ASTER_ASYNC_HPP
+
+/// C++ Includes
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+/// Aster Includes
+#include "aster/iterator.hpp"
+
+namespace Aster {
+
+    namespace Detail {
+
+        /**
+         * @brief Takes the next batch of entries from a (primed) iterator.
+         * @param iterator              Iterator to advance.
+         * @param size                  Maximum batch size.
+         */
+        static inline constexpr std::vector<Entry> batch(Iterator& iterator, size_t size) {
+            std::vector<Entry> entries = {};
+            entries.reserve(size);  // bounded upfront
+
+            // take entries until the batch is full
+            for (; entries.size() < size && iterator != iterator.end(); ++iterator) entries.emplace_back(*iterator);
+            return entries;
+        }
+
+    }  // namespace Detail
+
+    /// @brief Lazy Coroutine Generator.
+    template <typename T>
+    class Generator {
+       public:
+        //  TYPEDEFS  //
+
+        /// @brief Coroutine promise.
+        struct promise_type {
+            std::optional<T> value = std::nullopt;
+            std::exception_ptr exception = nullptr;
+
+            inline Generator get_return_object() noexcept { return Generator(Handle::from_promise(*this)); }
+            inline std::suspend_always initial_suspend() const noexcept { return {}; }
+            inline std::suspend_always final_suspend() const noexcept { return {}; }
+            inline std::suspend_always yield_value(T input) { return value = std::move(input), std::suspend_always(); }
+            inline void unhandled_exception() noexcept { exception = std::current_exception(); }
+            inline void return_void() const noexcept {}
+        };
+
+        /// @brief Coroutine handle.
+        using Handle = std::coroutine_handle<promise_type>;
+
+        /// @brief Generator input iterator.
+        class iterator {
+            //  PROPERTIES  //
+
+            /// @brief Associated coroutine.
+            Handle m_handle = nullptr;
+
+           public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+
+            //  CONSTRUCTORS  //
+
+            constexpr iterator() = default;
+            explicit constexpr iterator(Handle handle) : m_handle(handle) {}
+
+            //  OPERATOR METHODS  //
+
+            inline T& operator*() const noexcept { return *m_handle.promise().value; }
+            inline iterator& operator++() { return m_resume(m_handle), *this; }
+            inline void operator++(int) { ++*this; }
+            inline bool operator==(std::default_sentinel_t) const noexcept { return !m_handle || m_handle.done(); }
+        };
+
+       private:
+        //  PROPERTIES  //
+
+        /// @brief Associated coroutine.
+        Handle m_handle = nullptr;
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /**
+         * @brief Constructs a generator owning a coroutine.
+         * @param handle                Coroutine handle.
+         */
+        explicit constexpr Generator(Handle handle) : m_handle(handle) {}
+
+        constexpr Generator(const Generator&) = delete;
+        constexpr Generator(Generator&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+
+        /// @brief Ensures the coroutine frame is destroyed.
+        constexpr ~Generator() {
+            if (m_handle) m_handle.destroy();
+        }
+
+        //  PUBLIC METHODS  //
+
+        /// @brief Starts (or continues) the generator.
+        inline iterator begin() { return m_resume(m_handle), iterator(m_handle); }
+        inline std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /**
+         * @brief Resumes a coroutine (rethrowing any of its failures).
+         * @param handle                Coroutine handle.
+         */
+        static inline void m_resume(Handle handle) {
+            auto& promise = handle.promise();
+            if (promise.value.reset(), handle.resume(); promise.exception) std::rethrow_exception(promise.exception);
+        }
+    };
+
+    /// @brief Asynchronous Walk Stream (performing its directory syscalls on an executor).
+    template <typename Executor>
+    class Stream {
+        //  TYPEDEFS  //
+
+        /// @brief Awaitable next batch.
+        class Awaiter {
+            //  PROPERTIES  //
+
+            /// @brief Owning stream.
+            Stream* m_stream = nullptr;
+
+            /// @brief Resulting batch.
+            std::vector<Entry> m_batch = {};
+
+            /// @brief Any failure whilst walking.
+            std::exception_ptr m_exception = nullptr;
+
+           public:
+            //  CONSTRUCTORS  //
+
+            explicit constexpr Awaiter(Stream* stream) : m_stream(stream) {}
+
+            //  PUBLIC METHODS  //
+
+            inline bool await_ready() const noexcept { return false; }
+
+            /**
+             * @brief Schedules the batch on the executor, resuming the awaiter once ready.
+             * @param handle            Awaiting coroutine.
+             */
+            inline void await_suspend(std::coroutine_handle<> handle) {
+                m_stream->m_executor([this, handle] {
+                    try {
+                        m_batch = m_stream->m_next();
+                    } catch (...) { m_exception = std::current_exception(); }
+
+                    // and continue the awaiting coroutine now
+                    handle.resume();
+                });
+            }
+
+            inline std::vector<Entry> await_resume() {
+                if (m_exception) std::rethrow_exception(m_exception);
+                return std::move(m_batch);
+            }
+        };
+
+        //  PROPERTIES  //
+
+        /// @brief Owned walker pattern (the iterator views it).
+        Pattern m_pattern = {};
+
+        /// @brief Suspended walk.
+        Iterator m_iterator = Iterator(std::default_sentinel);
+
+        /// @brief Executor running the blocking work.
+        Executor m_executor;
+
+        /// @brief Maximum entries per batch.
+        size_t m_size = 0;
+
+        /// @brief Denotes if the walk was started (on the executor).
+        bool m_primed = false;
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /**
+         * @brief Constructs an asynchronous walk stream.
+         * @param pattern               Glob pattern.
+         * @param options               Iteration options.
+         * @param executor              Callable accepting a `void()` job to run (e.g. posting to a pool).
+         * @param size                  Maximum entries per batch (the only batch in flight).
+         */
+        constexpr Stream(const Pattern& pattern, const Options& options, Executor executor, size_t size) :
+            m_pattern(pattern), m_iterator(&m_pattern, options), m_executor(std::move(executor)),
+            m_size(std::max<size_t>(size, 1)) {}
+
+        constexpr Stream(const Stream&) = delete;
+        constexpr Stream& operator=(const Stream&) = delete;
+
+        //  PUBLIC METHODS  //
+
+        /**
+         * @brief Awaits the next batch of entries (empty once the walk is complete).
+         * @note Awaiting coroutines are resumed on the executor; only one batch may be awaited at a time.
+         */
+        inline Awaiter next() noexcept { return Awaiter(this); }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /// @brief Takes the next batch (the first advance opens the initial directory).
+        inline std::vector<Entry> m_next() {
+            if (!std::exchange(m_primed, true)) ++m_iterator;
+            return Detail::batch(m_iterator, m_size);
+        }
+    };
+
+}  // namespace Aster
+
+#endif
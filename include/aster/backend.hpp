@@ -0,0 +1,43 @@
+#ifndef _ASTER_BACKEND_HPP
+#define _ASTER_BACKEND_HPP
+
+/// C++ Includes
+#include <concepts>
+#include <memory>
+
+/// OS Includes
+#include "aster/unix/traversal.hpp"
+#include "aster/win32/traversal.hpp"
+
+namespace Aster {
+
+    /**
+     * @brief Traversal Backend Concept.
+     * @note Backends open a directory path into a traversal; virtual backends serve a buffered `Detail::Listing`.
+     */
+    template <typename T>
+    concept Backend = std::copy_constructible<T> && requires(const T& backend, const std::string& path) {
+        { backend.open(path, Sorting(), bool()) } -> std::convertible_to<std::shared_ptr<Detail::Traversal>>;
+    };
+
+    namespace Detail {
+
+        /// @brief Real Filesystem Backend.
+        struct System {
+            /**
+             * @brief Opens a directory traversal.
+             * @param path              Directory path.
+             * @param sorting           Listing sort order.
+             * @param buffered          Buffer the full listing upfront.
+             */
+            inline constexpr std::shared_ptr<Traversal> open(
+                const std::string& path, Sorting sorting, bool buffered) const {
+                return std::make_shared<Traversal>(path, sorting, buffered);
+            }
+        };
+
+    }  // namespace Detail
+
+}  // namespace Aster
+
+#endif
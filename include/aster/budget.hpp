@@ -0,0 +1,102 @@
+#ifndef _ASTER_BUDGET_HPP
+#define _ASTER_BUDGET_HPP
+
+/// C++ Includes
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <utility>
+
+namespace Aster {
+
+    /// @brief Shared Budget of Simultaneously Open Directory Handles.
+    class Budget {
+        //  PROPERTIES  //
+
+        /// @brief Guards the usage counter.
+        mutable std::mutex m_mutex = {};
+
+        /// @brief Signals whenever a handle is released.
+        std::condition_variable m_available = {};
+
+        /// @brief Maximum simultaneously open handles.
+        size_t m_limit = 1;
+
+        /// @brief Currently open handles.
+        size_t m_used = 0;
+
+       public:
+        //  TYPEDEFS  //
+
+        /// @brief Held handle slot (released on destruction).
+        class Lease {
+            //  PROPERTIES  //
+
+            /// @brief Owning budget (if held).
+            Budget* m_budget = nullptr;
+
+           public:
+            //  CONSTRUCTORS  //
+
+            /// @brief Constructs an empty lease.
+            constexpr Lease() = default;
+
+            /**
+             * @brief Constructs a held lease.
+             * @param budget            Owning budget.
+             */
+            explicit constexpr Lease(Budget* budget) : m_budget(budget) {}
+
+            constexpr Lease(const Lease&) = delete;
+            constexpr Lease(Lease&& other) noexcept : m_budget(std::exchange(other.m_budget, nullptr)) {}
+
+            /// @brief Releases the held slot.
+            constexpr ~Lease() {
+                if (m_budget) m_budget->m_release();
+            }
+        };
+
+        //  CONSTRUCTORS  //
+
+        /**
+         * @brief Constructs a handle budget.
+         * @param limit                 Maximum simultaneously open handles (at least one).
+         */
+        explicit constexpr Budget(size_t limit) : m_limit(std::max<size_t>(limit, 1)) {}
+
+        //  PUBLIC METHODS  //
+
+        /// @brief Gets the maximum simultaneously open handles.
+        inline constexpr size_t limit() const noexcept { return m_limit; }
+
+        /// @brief Gets the currently open handles.
+        inline size_t used() const {
+            auto lock = std::scoped_lock(m_mutex);
+            return m_used;
+        }
+
+        /// @brief Acquires a handle slot (waiting until one is available).
+        inline Lease acquire() {
+            auto lock = std::unique_lock(m_mutex);
+            m_available.wait(lock, [this] { return m_used < m_limit; });
+            return m_used += 1, Lease(this);
+        }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /// @brief Handles releasing a handle slot.
+        inline void m_release() {
+            {
+                auto lock = std::scoped_lock(m_mutex);
+                m_used -= 1;
+            }
+
+            // and wake a single waiter now
+            m_available.notify_one();
+        }
+    };
+
+}  // namespace Aster
+
+#endif
@@ -0,0 +1,157 @@
+#ifndef _ASTER_CACHE_HPP
+#define _ASTER_CACHE_HPP
+
+/// C++ Includes
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Aster {
+
+    /**
+     * @brief Thread-Safe Bounded (LRU) Cache of Immutable Values Keyed by Text.
+     * @tparam Value                Cached value type.
+     * @note Keys are hashed into independently locked shards, so lookups on different cores rarely contend.
+     */
+    template <typename Value>
+    class Cache {
+        //  TYPEDEFS  //
+
+        /// @brief Cached key and value (most recently used first).
+        using Entries = std::list<std::pair<std::string, std::shared_ptr<const Value>>>;
+
+        /// @brief Independently locked cache partition (padded against false sharing).
+        struct alignas(64) Shard {
+            mutable std::mutex mutex = {};
+            Entries entries = {};                                                      // recency order
+            std::unordered_map<std::string_view, typename Entries::iterator> lookup = {};  // views of entry keys
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+        };
+
+        //  PROPERTIES  //
+
+        /// @brief Cache partitions.
+        std::unique_ptr<Shard[]> m_shards = nullptr;
+
+        /// @brief Number of partitions.
+        size_t m_count = 1;
+
+        /// @brief Maximum cached values per partition.
+        size_t m_capacity = 1;
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /**
+         * @brief Constructs an empty cache.
+         * @param capacity              Maximum cached values (split evenly across the shards).
+         * @param shards                Number of independently locked shards.
+         */
+        explicit Cache(size_t capacity = 1024, size_t shards = 16) :
+            m_shards(std::make_unique<Shard[]>(std::max<size_t>(shards, 1))), m_count(std::max<size_t>(shards, 1)),
+            m_capacity(std::max<size_t>((capacity + m_count - 1) / m_count, 1)) {}
+
+        //  PUBLIC METHODS  //
+
+        /**
+         * @brief Gets a cached value (creating and caching it when missing).
+         * @param key                   Key text.
+         * @param create                Callback creating the value from the key (called without any lock held).
+         */
+        template <typename Factory>
+        inline std::shared_ptr<const Value> get(std::string_view key, Factory&& create) {
+            auto& shard = m_shard(key);
+            {
+                auto lock = std::scoped_lock(shard.mutex);
+                if (auto found = shard.lookup.find(key); found != shard.lookup.end()) {
+                    shard.entries.splice(shard.entries.begin(), shard.entries, found->second);  // most recent
+                    return shard.hits += 1, found->second->second;
+                }
+
+                shard.misses += 1;
+            }
+
+            // create the value unlocked (so slow creations never block other keys)
+            auto value = std::shared_ptr<const Value>(std::make_shared<Value>(create(key)));
+            auto lock = std::scoped_lock(shard.mutex);
+
+            // another thread may have raced to create the same value
+            if (auto found = shard.lookup.find(key); found != shard.lookup.end()) return found->second->second;
+
+            // otherwise insert it (evicting the least recently used values)
+            shard.entries.emplace_front(std::string(key), value);
+            shard.lookup.emplace(shard.entries.front().first, shard.entries.begin());
+            while (shard.entries.size() > m_capacity) {
+                shard.lookup.erase(shard.entries.back().first), shard.entries.pop_back();
+            }
+
+            // resolve the cached value
+            return value;
+        }
+
+        /// @brief Gets the number of lookups that found a cached value.
+        inline uint64_t hits() const { return m_sum(&Shard::hits); }
+
+        /// @brief Gets the number of lookups that had to create a value.
+        inline uint64_t misses() const { return m_sum(&Shard::misses); }
+
+        /// @brief Gets the number of cached values.
+        inline size_t size() const {
+            size_t size = 0;
+            for (size_t index = 0; index < m_count; ++index) {
+                auto lock = std::scoped_lock(m_shards[index].mutex);
+                size += m_shards[index].entries.size();
+            }
+
+            // resolve the total size
+            return size;
+        }
+
+        /// @brief Gets the maximum number of cached values.
+        inline constexpr size_t capacity() const noexcept { return m_capacity * m_count; }
+
+        /// @brief Drops every cached value (and resets the counters).
+        inline void clear() {
+            for (size_t index = 0; index < m_count; ++index) {
+                auto& shard = m_shards[index];
+                auto lock = std::scoped_lock(shard.mutex);
+                shard.lookup.clear(), shard.entries.clear(), shard.hits = 0, shard.misses = 0;
+            }
+        }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /**
+         * @brief Gets the shard owning a key.
+         * @param key                   Key text.
+         */
+        inline Shard& m_shard(std::string_view key) const {
+            return m_shards[std::hash<std::string_view>()(key) % m_count];
+        }
+
+        /**
+         * @brief Sums a counter across every shard.
+         * @param counter               Counter to sum.
+         */
+        inline uint64_t m_sum(uint64_t Shard::* counter) const {
+            uint64_t sum = 0;
+            for (size_t index = 0; index < m_count; ++index) {
+                auto lock = std::scoped_lock(m_shards[index].mutex);
+                sum += m_shards[index].*counter;
+            }
+
+            // resolve the summed counter
+            return sum;
+        }
+    };
+
+}  // namespace Aster
+
+#endif
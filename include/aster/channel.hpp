@@ -0,0 +1,121 @@
+#ifndef _ASTER_CHANNEL_HPP
+#define _ASTER_CHANNEL_HPP
+
+/// C++ Includes
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace Aster::Detail {
+
+    /**
+     * @brief Bounded Lock-Free Multi-Producer Multi-Consumer Ring.
+     * @tparam Value                Queued value type (default constructible and movable).
+     * @note Each cell carries a sequence number, so producers and consumers only contend on their own cursor.
+     */
+    template <typename Value>
+    class Channel {
+        //  TYPEDEFS  //
+
+        /// @brief Ring cell (its sequence denotes whether it is ready to fill or to take).
+        struct Cell {
+            std::atomic<size_t> sequence = 0;
+            Value value = {};
+        };
+
+        //  PROPERTIES  //
+
+        /// @brief Ring cells.
+        std::unique_ptr<Cell[]> m_cells = nullptr;
+
+        /// @brief Capacity mask (capacities are powers of two).
+        size_t m_mask = 0;
+
+        /// @brief Next position to take from (padded against false sharing with producers).
+        alignas(64) std::atomic<size_t> m_head = 0;
+
+        /// @brief Next position to fill.
+        alignas(64) std::atomic<size_t> m_tail = 0;
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /**
+         * @brief Constructs an empty ring.
+         * @param capacity              Minimum capacity (rounded up to a power of two).
+         */
+        explicit Channel(size_t capacity) :
+            m_cells(std::make_unique<Cell[]>(std::bit_ceil(std::max<size_t>(capacity, 2)))),
+            m_mask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1) {
+            for (size_t index = 0; index <= m_mask; ++index) {
+                m_cells[index].sequence.store(index, std::memory_order_relaxed);
+            }
+        }
+
+        Channel(const Channel&) = delete;
+
+        //  PUBLIC METHODS  //
+
+        /// @brief Gets the ring capacity.
+        inline constexpr size_t capacity() const noexcept { return m_mask + 1; }
+
+        /// @brief Denotes if the ring appears empty (only a hint whilst others push or pop).
+        inline bool empty() const noexcept {
+            return m_head.load(std::memory_order_acquire) >= m_tail.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Attempts pushing a value.
+         * @param value                 Value to push (moved from only on success).
+         * @returns False if the ring was full.
+         */
+        inline bool push(Value& value) noexcept(std::is_nothrow_move_assignable_v<Value>) {
+            auto position = m_tail.load(std::memory_order_relaxed);
+            for (;;) {
+                auto& cell = m_cells[position & m_mask];
+                auto difference = intptr_t(cell.sequence.load(std::memory_order_acquire)) - intptr_t(position);
+
+                // claim the cell if it is free (or give up once a full lap behind)
+                if (difference == 0) {
+                    if (!m_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) continue;
+                    cell.value = std::move(value), cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+
+                if (difference < 0) return false;
+                position = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Attempts popping a value.
+         * @param value                 Value to fill.
+         * @returns False if the ring was empty.
+         */
+        inline bool pop(Value& value) noexcept(std::is_nothrow_move_assignable_v<Value>) {
+            auto position = m_head.load(std::memory_order_relaxed);
+            for (;;) {
+                auto& cell = m_cells[position & m_mask];
+                auto difference = intptr_t(cell.sequence.load(std::memory_order_acquire)) - intptr_t(position + 1);
+
+                // take the cell if it was filled (releasing it for the next lap)
+                if (difference == 0) {
+                    if (!m_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) continue;
+                    value = std::move(cell.value);
+                    cell.sequence.store(position + m_mask + 1, std::memory_order_release);
+                    return true;
+                }
+
+                if (difference < 0) return false;
+                position = m_head.load(std::memory_order_relaxed);
+            }
+        }
+    };
+
+}  // namespace Aster::Detail
+
+#endif
@@ -66,8 +66,10 @@ namespace Aster::Detail {
         /**
          * @brief Compiles a set of pattern slices.
          * @param glob                  Glob to split.
+         * @param matching              Matching mode for globs needing the general matcher.
          */
-        inline constexpr Encoded pattern(const std::string_view& glob) const noexcept {
+        inline constexpr Encoded pattern(
+            const std::string_view& glob, Matching matching = Matching::BACKTRACKING) const noexcept {
             // handle empty globs immediately
             if (glob.empty()) return m_empty;
 
@@ -82,12 +84,20 @@ namespace Aster::Detail {
             auto flags = m_flags(prefix, slices, negation % 2);
 
             // handles deciding a suitable matching algorithm
-            auto algorithm = m_algorithm(glob, slices, flags);
+            auto algorithm = m_algorithm(glob, slices, flags, matching);
 
             // and return the final enoded result
             return { prefix, slices, algorithm, flags };
         }
 
+        /**
+         * @brief Splits a (negation-free) glob into slices viewing the given buffer.
+         * @param glob                  Glob to split.
+         */
+        inline constexpr std::vector<Slice> slices(const std::string_view& glob) const noexcept {
+            return glob.empty() ? std::vector<Slice>() : m_process(State(), glob);
+        }
+
        private:
         //  PRIVATE METHODS  //
 
@@ -116,9 +126,10 @@ namespace Aster::Detail {
          * @param glob                  Glob pattern to deduce.
          * @param slices                Associated slices of glob.
          * @param flags                 Flags to help deductions.
+         * @param matching              Matching mode for the general matcher.
          */
-        inline constexpr Algorithm m_algorithm(
-            const std::string_view& glob, const std::span<Slice>& slices, const Flags& flags = {}) const noexcept {
+        inline constexpr Algorithm m_algorithm(const std::string_view& glob, const std::span<Slice>& slices,
+                                               const Flags& flags, Matching matching) const noexcept {
             // resolve a baseline empty match handler for patterns
             if (glob.empty()) return Match::empty;
 
@@ -130,11 +141,14 @@ namespace Aster::Detail {
 
             // allow testing for fast "extension" matches now
             if (auto size = slices.size(); size && slices.back().hint() == Hint::EXTENDS) {
-                if (size == 1 || m_globstar(slices.subspan(0, size - 1))) return Match::extends;
+                if (size > 1 && m_globstar(slices.subspan(0, size - 1))) return Match::extends;
+                if (size == 1) return [](auto suffix, const auto& name) {
+                    return name.find_first_of(Detail::separator()) == name.npos && Match::extends(suffix, name);
+                };
             }
 
-            // otherwise default to the baseline matcher
-            return Match::glob;
+            // otherwise default to the baseline matcher (unless linear time is required)
+            return matching == Matching::LINEAR ? Match::linear : Match::glob;
         }
 
         /**
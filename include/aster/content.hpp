@@ -0,0 +1,141 @@
+#ifndef _ASTER_CONTENT_HPP
+#define _ASTER_CONTENT_HPP
+
+/// C++ Includes
+#include <fstream>
+#include <string>
+#include <utility>
+
+/// Aster Includes
+#include "aster/detail.hpp"
+
+#ifdef _ASTER_PLATFORM_UNIX
+/// OS Includes
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Aster {
+
+    /// @brief Matched File Content (opened upfront, mapped on first access).
+    class Content {
+        //  PROPERTIES  //
+
+        /// @brief The associated file path.
+        std::string m_path = {};
+
+        /// @brief Resolved content view.
+        std::string_view m_view = {};
+
+        /// @brief Fallback buffer (when mapping is unavailable).
+        std::string m_buffer = {};
+
+        /// @brief Mapped region (if any).
+        void* m_mapping = nullptr;
+
+        /// @brief Mapped region size.
+        size_t m_size = 0;
+
+        /// @brief Open file descriptor (if any).
+        int m_descriptor = -1;
+
+        /// @brief Denotes if the content was resolved.
+        bool m_resolved = false;
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /// @brief Constructs empty content.
+        constexpr Content() = default;
+
+        /**
+         * @brief Opens a file, hinting the kernel to start reading it ahead.
+         * @param path                  File path.
+         */
+        explicit constexpr Content(const std::string& path) : m_path(path) {
+#ifdef _ASTER_PLATFORM_UNIX
+            m_descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+#ifdef POSIX_FADV_WILLNEED
+            if (m_descriptor >= 0) ::posix_fadvise(m_descriptor, 0, 0, POSIX_FADV_WILLNEED);
+#endif
+#endif
+        }
+
+        constexpr Content(const Content&) = delete;
+        constexpr Content(Content&& other) noexcept { m_swap(other); }
+
+        /// @brief Ensures the mapping and descriptor are released.
+        constexpr ~Content() { m_release(); }
+
+        //  OPERATOR METHODS  //
+
+        inline constexpr Content& operator=(Content&& other) noexcept {
+            if (this != &other) m_release(), m_swap(other);
+            return *this;
+        }
+
+        //  PUBLIC METHODS  //
+
+        /// @brief Gets the associated file path.
+        inline constexpr const std::string& path() const noexcept { return m_path; }
+
+        /// @brief Gets the file content (mapping or reading it on first access, empty on failure).
+        inline constexpr std::string_view view() {
+            if (!std::exchange(m_resolved, true)) m_resolve();
+            return m_view;
+        }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /// @brief Handles resolving the content view.
+        inline constexpr void m_resolve() {
+#ifdef _ASTER_PLATFORM_UNIX
+            struct ::stat status = {};
+            if (m_descriptor < 0 || ::fstat(m_descriptor, &status) != 0 || status.st_size <= 0) return;
+
+            // map the whole file in sequential read mode
+            m_size = size_t(status.st_size);
+            m_mapping = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_descriptor, 0);
+            if (m_mapping != MAP_FAILED) {
+                ::madvise(m_mapping, m_size, MADV_SEQUENTIAL);
+                return void(m_view = { static_cast<const char*>(m_mapping), m_size });
+            }
+
+            // otherwise fall back to reading the file in full
+            m_mapping = nullptr, m_size = 0;
+#endif
+            auto stream = std::ifstream(m_path, std::ios::binary);
+            m_buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+            m_view = m_buffer;
+        }
+
+        /// @brief Handles releasing the mapping and descriptor.
+        inline constexpr void m_release() noexcept {
+#ifdef _ASTER_PLATFORM_UNIX
+            if (m_mapping != nullptr) ::munmap(m_mapping, m_size);
+            if (m_descriptor >= 0) ::close(m_descriptor);
+#endif
+            m_mapping = nullptr, m_size = 0, m_descriptor = -1;
+        }
+
+        /**
+         * @brief Handles swapping state with another instance.
+         * @param other                 Content to swap with.
+         */
+        inline constexpr void m_swap(Content& other) noexcept {
+            std::swap(m_path, other.m_path), std::swap(m_buffer, other.m_buffer), std::swap(m_view, other.m_view);
+            std::swap(m_mapping, other.m_mapping), std::swap(m_size, other.m_size);
+            std::swap(m_descriptor, other.m_descriptor), std::swap(m_resolved, other.m_resolved);
+
+            // unmapped views must point into their own buffer (which may be inline)
+            if (m_resolved && m_mapping == nullptr) m_view = m_buffer;
+            if (other.m_resolved && other.m_mapping == nullptr) other.m_view = other.m_buffer;
+        }
+    };
+
+}  // namespace Aster
+
+#endif
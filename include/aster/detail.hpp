@@ -2,6 +2,7 @@
 #define _ASTER_DETAIL_HPP
 
 /// C++ Includes
+#include <cstdint>
 #include <cstdlib>
 #include <string>
 #include <string_view>
@@ -25,12 +26,19 @@
 #define _ASTER_PLATFORM_UNIX
 #define _ASTER_PLATFORM_GETCWD ::getcwd
 
+#ifdef __linux__
+#define _ASTER_PLATFORM_LINUX
+#endif
+
 /// OS Includes
 #include <unistd.h>
 #endif
 
 namespace Aster::Detail {
 
+    /// @brief Maximum number of patterns a single walk can report.
+    static inline constexpr size_t capacity() { return 64; }
+
     /// @brief Describes a wildcard/globstar sequence.
     static inline constexpr std::string_view wildcard() { return "*"; }
     static inline constexpr std::string_view globstar() { return "**"; }
@@ -102,6 +110,59 @@ namespace Aster::Detail {
 #endif
     }
 
+    /**
+     * @brief Handles join path segments together into an existing buffer (reusing its capacity).
+     * @param output            Output buffer.
+     * @param prefix            Prefix segment.
+     * @param suffix            Suffix segment.
+     */
+    static inline constexpr std::string& join(
+        std::string& output, const std::string_view& prefix, const std::string_view& suffix) {
+#ifdef _ASTER_PLATFORM_WIN32
+        return output.assign(prefix).append(1, '\\').append(suffix);
+#else
+        return output.assign(prefix).append(1, '/').append(suffix);
+#endif
+    }
+
+    /**
+     * @brief Compares two names in natural order (digit runs compare numerically).
+     * @param lhs               Left-hand name.
+     * @param rhs               Right-hand name.
+     */
+    static inline constexpr int natural(const std::string_view& lhs, const std::string_view& rhs) {
+        auto digit = [](char ch) { return '0' <= ch && ch <= '9'; };
+
+        // walk both names whilst there is input remaining
+        size_t i = 0, j = 0;
+        while (i < lhs.size() && j < rhs.size()) {
+            // compare non-digits byte-wise
+            if (!digit(lhs[i]) || !digit(rhs[j])) {
+                if (lhs[i] != rhs[j]) return uint8_t(lhs[i]) < uint8_t(rhs[j]) ? -1 : 1;
+                i += 1, j += 1;
+                continue;
+            }
+
+            // skip any leading zeros of both runs
+            while (i < lhs.size() && lhs[i] == '0') i += 1;
+            while (j < rhs.size() && rhs[j] == '0') j += 1;
+
+            // find the remaining run lengths
+            auto a = i, b = j;
+            while (a < lhs.size() && digit(lhs[a])) a += 1;
+            while (b < rhs.size() && digit(rhs[b])) b += 1;
+
+            // longer runs are larger, otherwise compare digit-wise
+            if (a - i != b - j) return a - i < b - j ? -1 : 1;
+            if (auto order = lhs.substr(i, a - i).compare(rhs.substr(j, b - j))) return order < 0 ? -1 : 1;
+            i = a, j = b;
+        }
+
+        // otherwise the shorter remainder is ordered first
+        auto left = lhs.size() - i, right = rhs.size() - j;
+        return left == right ? 0 : left < right ? -1 : 1;
+    }
+
     /// @brief Allows getting the current-working directory.
     static inline constexpr std::string getcwd() {
         // attempt getting the baseline buffer
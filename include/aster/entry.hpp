@@ -9,6 +9,16 @@ namespace Aster {
     /// @brief Available Entry Types.
     enum class Archetype : uint8_t { INVALID, REGULAR, DIRECTORY, SYMLINK };
 
+    /// @brief Available Sorting Orders.
+    enum class Sorting : uint8_t {
+        NONE,      // listing order
+        BYTEWISE,  // byte-wise names
+        NATURAL,   // digit runs compared numerically
+    };
+
+    /// @brief Matched Patterns Bitmask.
+    using Mask = uint64_t;
+
     /// @brief Iterator Entry Result.
     struct Entry {
         //  PROPERTIES  //
@@ -19,6 +29,9 @@ namespace Aster {
         /// @brief Denotes an unknown entry.
         Archetype type = Archetype::INVALID;
 
+        /// @brief Bitmask of the walker patterns matched.
+        Mask mask = 0;
+
         //  CONSTRUCTORS  //
 
         /// @brief Constructs a defaulted entry.
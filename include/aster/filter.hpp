@@ -0,0 +1,156 @@
+#ifndef _ASTER_FILTER_HPP
+#define _ASTER_FILTER_HPP
+
+/// C++ Includes
+#include <algorithm>
+#include <functional>
+#include <span>
+
+/// Aster Includes
+#include "aster/options.hpp"
+#include "aster/pattern.hpp"
+
+namespace Aster::Detail {
+
+    /// @brief Traversal Entry Filter.
+    class Filter {
+        //  PROPERTIES  //
+
+        /// @brief Associated glob patterns.
+        std::span<const Pattern> m_patterns = {};
+
+        /// @brief Length of the working directory prefix.
+        size_t m_prefix = 0;
+
+        bool m_files = true;         // Allow matching files.
+        bool m_hidden = false;       // Allow matching hidden.
+        bool m_symlinks = false;     // Allow matching symlinks.
+        bool m_directories = false;  // Allow matching directories.
+        bool m_recursive = false;    // Denotes if any pattern is recursive.
+
+        /// @brief Optional predicate pruning directories.
+        std::function<bool(std::string_view)> m_prune = nullptr;
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /// @brief Constructs an empty filter.
+        constexpr Filter() = default;
+
+        /**
+         * @brief Constructs an entry filter.
+         * @param patterns              Glob patterns (at most `Detail::capacity()`).
+         * @param options               Traversal options.
+         */
+        constexpr Filter(std::span<const Pattern> patterns, const Options& options) :
+            m_patterns(patterns.first(std::min(patterns.size(), Detail::capacity()))),
+            m_prefix(options.cwd.size() + 1),
+            m_files(options.files),
+            m_hidden(options.hidden),
+            m_symlinks(options.symlinks),
+            m_directories(options.directories),
+            m_recursive(std::ranges::any_of(m_patterns, &Pattern::recursive)),
+            m_prune(options.prune) {}
+
+        //  PUBLIC METHODS  //
+
+        /// @brief Gets the associated patterns.
+        inline constexpr std::span<const Pattern> patterns() const noexcept { return m_patterns; }
+
+        /**
+         * @brief Checks if a directory could contain matches and should be descended.
+         * @param path                  Directory path.
+         * @note Only directories that could contain matches are checked against `Options::prune`.
+         */
+        inline constexpr bool descends(const std::string_view& path) const {
+            if (!m_recursive) return false;  // only the initial directory is listed
+
+            // hidden directories are pruned unless a pattern explicitly names them
+            auto name = path.substr(path.find_last_of(Detail::separator()) + 1);
+            auto hidden = !m_hidden && name.starts_with('.');
+
+            auto descends = std::ranges::any_of(m_patterns, [&](const Pattern& pattern) {
+                if (hidden && !m_dotted(pattern, name)) return false;
+                return pattern.descends(pattern.absolute() ? path : path.substr(m_prefix));
+            });
+
+            // and the caller may prune any of the rest
+            return descends && !(m_prune && m_prune(path));
+        }
+
+        /**
+         * @brief Handles testing incoming entries.
+         * @param entry                 Traversal entry.
+         */
+        inline constexpr Mask test(const Entry& entry) const noexcept {
+            // hande the incoming entry typing
+            switch (entry.type) {
+                case Archetype::REGULAR: return m_files ? test(entry.path) : 0;
+                case Archetype::SYMLINK: return m_symlinks ? test(entry.path) : 0;
+                case Archetype::DIRECTORY: return m_directories ? test(entry.path) : 0;
+                default: return 0;
+            }
+        }
+
+        /**
+         * @brief Handles testing incoming paths against all patterns.
+         * @param input                 Input path.
+         */
+        inline constexpr Mask test(std::string_view input) const noexcept {
+            Mask mask = 0;  // prepare the resulting mask
+            for (size_t index = 0; index < m_patterns.size(); ++index) {
+                if (m_test(m_patterns[index], input)) mask |= Mask(1) << index;
+            }
+
+            // and return the matched patterns
+            return mask;
+        }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /**
+         * @brief Handles testing incoming paths.
+         * @param pattern               Pattern to test.
+         * @param input                 Input path.
+         */
+        inline constexpr bool m_test(const Pattern& pattern, std::string_view input) const noexcept {
+            if (!m_hidden && !m_visible(pattern, input.substr(m_prefix))) return false;
+            if (!pattern.absolute()) input.remove_prefix(m_prefix);
+            return pattern.matches(input);  // check if the input matches now
+        }
+
+        /**
+         * @brief Checks that every hidden segment of a relative path is explicitly named by a pattern.
+         * @param pattern               Pattern to test.
+         * @param path                  Relative path.
+         */
+        static inline constexpr bool m_visible(const Pattern& pattern, std::string_view path) noexcept {
+            for (size_t start = 0; start < path.size();) {
+                auto ending = std::min(path.find_first_of(Detail::separator(), start), path.size());
+                auto segment = path.substr(start, ending - start);
+
+                // hidden segments need a matching dot-slice
+                if (segment.starts_with('.') && !m_dotted(pattern, segment)) return false;
+                start = ending + 1;
+            }
+
+            // every segment is visible now
+            return true;
+        }
+
+        /**
+         * @brief Checks if a hidden segment matches one of the patterns explicit dot-slices.
+         * @param pattern               Pattern to test.
+         * @param segment               Hidden segment.
+         */
+        static inline constexpr bool m_dotted(const Pattern& pattern, std::string_view segment) noexcept {
+            return std::ranges::any_of(pattern.slices(), [&](const Slice& slice) {
+                return slice.view().starts_with('.') && Match::glob(slice.view(), segment);
+            });
+        }
+    };
+
+}  // namespace Aster::Detail
+
+#endif
@@ -0,0 +1,191 @@
+#ifndef _ASTER_INCREMENTAL_HPP
+#define _ASTER_INCREMENTAL_HPP
+
+/// C++ Includes
+#include <algorithm>
+#include <cstdint>
+#include <ranges>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// Aster Includes
+#include "aster/entry.hpp"
+#include "aster/pattern.hpp"
+
+namespace Aster {
+
+    /**
+     * @brief Prefix-Incremental Matcher (for sorted path streams, where consecutive paths share long prefixes).
+     * @note The active pattern slices are checkpointed after each directory segment, so matching a path resumes
+     *       from the deepest checkpoint shared with the previous path (negated globs, and braces spanning
+     *       separators, match each path whole instead).
+     */
+    class Incremental {
+        //  PROPERTIES  //
+
+        /// @brief Pattern to match.
+        Pattern m_pattern = {};
+
+        /// @brief Denotes if paths are matched whole (for globs that cannot be followed per-segment).
+        bool m_whole = true;
+
+        /// @brief Previous path.
+        std::string m_path = {};
+
+        /// @brief Active slices after each directory segment of the previous path (bit `size` denotes a match).
+        std::vector<Mask> m_active = {};
+
+        /// @brief Offsets of the segment following each checkpoint.
+        std::vector<size_t> m_starts = {};
+
+        /// @brief Length of the previous paths prefix that no path can extend to a match (zero when none).
+        size_t m_dead = 0;
+
+        /// @brief Segments resumed from checkpoints (rather than matched again).
+        uint64_t m_reused = 0;
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /// @brief Constructs a matcher of the empty pattern.
+        constexpr Incremental() : Incremental(Pattern()) {}
+
+        /**
+         * @brief Constructs an incremental matcher.
+         * @param pattern               Pattern to match.
+         */
+        explicit constexpr Incremental(Pattern pattern) : m_pattern(std::move(pattern)) {
+            auto slices = m_pattern.slices();
+            auto followed = std::ranges::none_of(slices, [](const Slice& slice) {
+                auto braces = std::ranges::count(slice.view(), '{') != std::ranges::count(slice.view(), '}');
+                return braces || slice.view().starts_with('!');  // not testable per-segment
+            });
+
+            // globstar-only patterns match anything, and leading globstars never prune (so fast paths stay faster)
+            auto unprunable = slices.size() && slices.front().hint() == Hint::GLOBSTAR && m_pattern.complexity() == 1;
+            m_whole = !followed || slices.empty() || m_pattern.negated() || m_pattern.globstar() || unprunable ||
+                      slices.size() >= Detail::capacity();
+            reset();
+        }
+
+        //  PUBLIC METHODS  //
+
+        /// @brief Gets the pattern matched.
+        inline constexpr const Pattern& pattern() const noexcept { return m_pattern; }
+
+        /**
+         * @brief Handles matching the next path (resuming from the longest directory prefix of the previous one).
+         * @param path                  Path to match.
+         */
+        inline constexpr bool matches(std::string_view path) {
+            if (m_whole) return m_pattern.matches(path);
+
+            // resume from the deepest checkpoint within the common prefix
+            auto common = size_t(std::ranges::mismatch(path, m_path).in1 - path.begin());
+            auto depth = size_t(std::ranges::upper_bound(m_starts, common) - m_starts.begin()) - 1;
+            m_active.resize(depth + 1), m_starts.resize(depth + 1), m_reused += depth;
+            m_path.assign(path), m_dead = 0;
+
+            // and step through every remaining segment
+            auto accept = Mask(1) << m_pattern.slices().size();
+            for (auto active = m_active.back(), start = m_starts.back();;) {
+                if ((active & ~accept) == 0) return m_dead = start, false;  // nothing deeper can match
+
+                // empty segments (other than a leading root) are matched whole
+                auto ending = std::min(path.find_first_of(Detail::separator(), start), path.size());
+                if (ending == start && (start || ending == path.size())) return reset(), m_pattern.matches(path);
+
+                // the final segment decides the match
+                active = m_step(active, path.substr(start, ending - start));
+                if (ending == path.size()) return active & accept;
+
+                // whereas directory segments are checkpointed
+                start = ending + 1;
+                m_active.push_back(active), m_starts.push_back(start);
+            }
+        }
+
+        /// @brief Gets the previous paths prefix (ending at a separator) that no path can extend to a match.
+        inline constexpr std::string_view pruned() const noexcept {
+            return std::string_view(m_path).substr(0, m_dead);
+        }
+
+        /**
+         * @brief Checks if a path is within the pruned prefix (so cannot match).
+         * @param path                  Path to check.
+         */
+        inline constexpr bool skips(std::string_view path) const noexcept {
+            return m_dead && path.starts_with(pruned());
+        }
+
+        /**
+         * @brief Finds the first path (from an index) outside the pruned prefix.
+         * @param paths                 Lexicographically sorted paths.
+         * @param index                 Index to start from.
+         */
+        template <std::ranges::random_access_range Paths>
+        inline constexpr size_t skip(const Paths& paths, size_t index) const {
+            auto first = std::ranges::begin(paths) + std::min(index, size_t(std::ranges::size(paths)));
+            if (m_dead == 0) return size_t(first - std::ranges::begin(paths));
+
+            // pruned paths are contiguous once sorted
+            auto found = std::partition_point(first, std::ranges::end(paths), [&](const auto& path) {
+                return skips(path);
+            });
+            return size_t(found - std::ranges::begin(paths));
+        }
+
+        /// @brief Gets the number of segments resumed from checkpoints (rather than matched again).
+        inline constexpr uint64_t reused() const noexcept { return m_reused; }
+
+        /// @brief Drops every checkpoint (the next path is matched from its start).
+        inline constexpr void reset() noexcept {
+            m_path.clear(), m_active.clear(), m_starts.clear(), m_dead = 0;
+            if (!m_whole) m_active.push_back(m_closure(1)), m_starts.push_back(0);
+        }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /**
+         * @brief Handles stepping the active slices over a segment.
+         * @param active                Active slices.
+         * @param segment               Path segment.
+         */
+        inline constexpr Mask m_step(Mask active, std::string_view segment) const noexcept {
+            auto slices = m_pattern.slices();
+            Mask next = 0;
+            for (size_t index = 0; index < slices.size(); ++index) {
+                if (!(active & Mask(1) << index)) continue;
+
+                // globstars consume any segment (completing the match when trailing)
+                if (slices[index].hint() == Hint::GLOBSTAR) {
+                    next |= Mask(1) << index;
+                    if (index + 1 == slices.size()) next |= Mask(2) << index;
+                } else if (Pattern::admits(slices[index], segment)) next |= Mask(2) << index;
+            }
+
+            // resolve the next active slices
+            return m_closure(next);
+        }
+
+        /**
+         * @brief Activates the slices following any inner globstars (which may match no segments at all).
+         * @param active                Active slices.
+         * @note Trailing globstars must match at least one segment (as with `Pattern::matches`).
+         */
+        inline constexpr Mask m_closure(Mask active) const noexcept {
+            auto slices = m_pattern.slices();
+            for (size_t index = 0; index + 1 < slices.size(); ++index) {
+                if (active & Mask(1) << index && slices[index].hint() == Hint::GLOBSTAR) active |= Mask(2) << index;
+            }
+
+            // resolve the closed active slices
+            return active;
+        }
+    };
+
+}  // namespace Aster
+
+#endif
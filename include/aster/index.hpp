@@ -0,0 +1,358 @@
+#ifndef _ASTER_INDEX_HPP
+#define _ASTER_INDEX_HPP
+
+/// C++ Includes
+#include <algorithm>
+#include <cstdint>
+#include <ranges>
+#include <string>
+#include <vector>
+
+/// Aster Includes
+#include "aster/walker.hpp"
+
+namespace Aster {
+
+    /**
+     * @brief Path Index (a segment trie with names in a shared arena, queried by pattern slices).
+     * @note Indexes are immutable once built, so concurrent queries are safe.
+     */
+    class Index {
+        //  PROPERTIES  //
+
+        /// @brief Segment names arena.
+        std::string m_names = {};
+
+        /// @brief Name offsets of each node in pre-order (a name runs until the next nodes offset).
+        std::vector<size_t> m_offsets = {};
+
+        /// @brief Types of each node (`Archetype::INVALID` for implied parent directories).
+        std::vector<Archetype> m_types = {};
+
+        /// @brief Offsets of each nodes children (one past the last node is the final ending).
+        std::vector<uint32_t> m_first = {};
+
+        /// @brief Children of every node (contiguous per parent, sorted by name).
+        std::vector<uint32_t> m_children = {};
+
+        /// @brief Number of indexed entries.
+        size_t m_size = 0;
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /// @brief Constructs an empty index.
+        constexpr Index() : Index(std::vector<Entry>()) {}
+
+        /**
+         * @brief Constructs an index of paths (as regular files).
+         * @param paths                 Paths to index.
+         */
+        constexpr Index(std::initializer_list<std::string_view> paths) :
+            Index(std::vector(paths.begin(), paths.end())) {}
+        constexpr Index(const std::vector<std::string_view>& paths) : Index(m_entries(paths)) {}
+        constexpr Index(const std::vector<std::string>& paths) : Index(m_entries(paths)) {}
+
+        /**
+         * @brief Constructs an index of entries.
+         * @param entries               Entries to index (duplicate paths keep their last type).
+         */
+        constexpr Index(std::vector<Entry> entries) { m_build(std::move(entries)); }
+
+        /**
+         * @brief Constructs an index from a walk (relative to `Options::cwd` unless the pattern is absolute).
+         * @param walker                Walker to index the matches of.
+         * @param options               Iteration options.
+         * @param backend               Traversal backend.
+         */
+        template <Backend Source = Detail::System>
+        constexpr Index(const Walker& walker, const Options& options, const Source& backend = {}) :
+            Index(m_walk(walker, options, backend)) {}
+
+        //  PUBLIC METHODS  //
+
+        /// @brief Gets the number of indexed entries.
+        inline constexpr size_t size() const noexcept { return m_size; }
+
+        /// @brief Denotes if no entries are indexed.
+        inline constexpr bool empty() const noexcept { return m_size == 0; }
+
+        /// @brief Gets the (approximate) heap footprint in bytes.
+        inline constexpr size_t bytes() const noexcept {
+            auto nodes = m_offsets.capacity() * sizeof(size_t) + m_types.capacity() * sizeof(Archetype);
+            auto edges = (m_first.capacity() + m_children.capacity()) * sizeof(uint32_t);
+            return m_names.capacity() + nodes + edges;
+        }
+
+        /**
+         * @brief Pushes every indexed entry matching a pattern to a visitor (in path order).
+         * @param pattern               Glob pattern.
+         * @param visitor               Callback taking a `const Entry&` and returning a `Visit` action (or void).
+         * @note Literal slices are direct child lookups and non-matching subtrees are never entered.
+         * @returns False if the query was stopped early.
+         */
+        template <typename Visitor>
+        inline constexpr bool query(const Pattern& pattern, Visitor&& visitor) const {
+            auto path = std::string();
+            auto slices = pattern.slices();
+
+            // negations (or braces spanning separators) cannot be followed per-segment
+            auto spanning = std::ranges::any_of(slices, [](const Slice& slice) {
+                return std::ranges::count(slice.view(), '{') != std::ranges::count(slice.view(), '}');
+            });
+
+            // so those (along with overly long patterns) visit every entry instead
+            if (pattern.negated() || spanning || slices.size() >= Detail::capacity()) {
+                return m_scan(pattern, visitor, 0, path);
+            }
+
+            // otherwise descend from the root with only the first slice active
+            return m_query(pattern, visitor, 0, Mask(1), path);
+        }
+
+        /**
+         * @brief Collects every indexed entry matching a pattern.
+         * @param pattern               Glob pattern.
+         */
+        inline constexpr std::vector<Entry> find(const Pattern& pattern) const {
+            std::vector<Entry> entries = {};
+            return query(pattern, [&](const Entry& entry) { entries.emplace_back(entry); }), entries;
+        }
+
+        /**
+         * @brief Counts the indexed entries matching a pattern.
+         * @param pattern               Glob pattern.
+         */
+        inline constexpr size_t count(const Pattern& pattern) const {
+            size_t count = 0;  // only the tally is kept
+            return query(pattern, [&](const Entry&) { ++count; }), count;
+        }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /**
+         * @brief Handles descending a node whilst tracking the active pattern slices.
+         * @param pattern               Glob pattern.
+         * @param visitor               Entry visitor.
+         * @param node                  Node index.
+         * @param active                Bitmask of active slices (bit `size` denotes a complete match).
+         * @param path                  Path of the node (restored before returning).
+         * @returns False if the query was stopped early.
+         */
+        template <typename Visitor>
+        inline constexpr bool m_query(
+            const Pattern& pattern, Visitor& visitor, uint32_t node, Mask active, std::string& path) const {
+            auto slices = pattern.slices();
+
+            // globstars may match no segments at all
+            auto scan = false;
+            for (size_t index = 0; index < slices.size(); ++index) {
+                if (!(active & Mask(1) << index)) continue;
+                if (slices[index].hint() == Hint::GLOBSTAR) active |= Mask(2) << index;
+
+                // only plain literals can be looked up directly
+                auto literal = slices[index].hint() == Hint::LITERAL && !slices[index].view().contains('\\');
+                scan = scan || !literal;
+            }
+
+            // visit the node if every slice was consumed
+            if (node && active & Mask(1) << slices.size() && !m_visit(pattern, visitor, node, path)) return false;
+
+            // descends into a child with the slices its name admits
+            auto descend = [&](uint32_t child) {
+                auto name = m_name(child);
+                Mask next = 0;
+                for (size_t index = 0; index < slices.size(); ++index) {
+                    if (!(active & Mask(1) << index)) continue;
+                    if (slices[index].hint() == Hint::GLOBSTAR) next |= Mask(1) << index;
+                    else if (Pattern::admits(slices[index], name)) next |= Mask(2) << index;
+                }
+
+                // non-matching subtrees are skipped entirely
+                if (next == 0) return true;
+                auto size = path.size();
+                if (node) path += Detail::separator().back();
+                auto completed = (path += name, m_query(pattern, visitor, child, next, path));
+                return path.resize(size), completed;
+            };
+
+            // wildcards scan every child, whereas literals are looked up by name
+            auto children = std::span(m_children).subspan(m_first[node], m_first[node + 1] - m_first[node]);
+            if (scan) return std::ranges::all_of(children, descend);
+            std::vector<uint32_t> found = {};
+            for (size_t index = 0; index < slices.size(); ++index) {
+                auto child = active & Mask(1) << index ? m_lookup(children, slices[index].view()) : s_none;
+                if (child != s_none) found.push_back(child);
+            }
+
+            // repeated literals find the same child, which is only descended once (in path order)
+            std::ranges::sort(found);
+            auto [first, last] = std::ranges::unique(found);
+            return std::ranges::all_of(found.begin(), first, descend);
+        }
+
+        /**
+         * @brief Handles visiting every entry beneath a node (for patterns that cannot be followed per-segment).
+         * @param pattern               Glob pattern.
+         * @param visitor               Entry visitor.
+         * @param node                  Node index.
+         * @param path                  Path of the node (restored before returning).
+         * @returns False if the query was stopped early.
+         */
+        template <typename Visitor>
+        inline constexpr bool m_scan(const Pattern& pattern, Visitor& visitor, uint32_t node, std::string& path) const {
+            if (node && !m_visit(pattern, visitor, node, path)) return false;
+            for (auto child : std::span(m_children).subspan(m_first[node], m_first[node + 1] - m_first[node])) {
+                auto size = path.size();
+                if (node) path += Detail::separator().back();
+                auto completed = (path += m_name(child), m_scan(pattern, visitor, child, path));
+                if (path.resize(size); !completed) return false;
+            }
+
+            // every entry was visited
+            return true;
+        }
+
+        /**
+         * @brief Handles visiting an indexed node if it matches.
+         * @param pattern               Glob pattern.
+         * @param visitor               Entry visitor.
+         * @param node                  Node index.
+         * @param path                  Path of the node.
+         * @returns False if the visitor stopped the query.
+         */
+        template <typename Visitor>
+        inline constexpr bool m_visit(
+            const Pattern& pattern, Visitor& visitor, uint32_t node, const std::string& path) const {
+            if (m_types[node] == Archetype::INVALID || !pattern.matches(path)) return true;
+
+            // void visitors always continue
+            auto entry = Entry(path, m_types[node]);
+            if constexpr (std::is_void_v<std::invoke_result_t<Visitor&, const Entry&>>) return visitor(entry), true;
+            else return visitor(std::as_const(entry)) != Visit::STOP;
+        }
+
+        /**
+         * @brief Finds a child by name.
+         * @param children              Sorted children.
+         * @param name                  Child name.
+         */
+        inline constexpr uint32_t m_lookup(std::span<const uint32_t> children, std::string_view name) const {
+            auto found = std::ranges::lower_bound(children, name, std::less(), [&](uint32_t child) {
+                return m_name(child);
+            });
+            return found != children.end() && m_name(*found) == name ? *found : s_none;
+        }
+
+        /**
+         * @brief Gets a nodes name.
+         * @param index                 Node index.
+         */
+        inline constexpr std::string_view m_name(uint32_t index) const noexcept {
+            auto ending = index + 1 < m_offsets.size() ? m_offsets[index + 1] : m_names.size();
+            return std::string_view(m_names).substr(m_offsets[index], ending - m_offsets[index]);
+        }
+
+        /**
+         * @brief Handles building the trie from a set of entries.
+         * @param entries               Entries to index.
+         */
+        inline constexpr void m_build(std::vector<Entry> entries) {
+            // order paths segment-wise (separators before any other character), so siblings are sorted by name
+            auto key = [](std::string_view path) {
+                auto rank = [](char ch) { return Detail::separator(ch) ? 0 : uint8_t(ch) + 1; };
+                return path | std::views::transform(rank);
+            };
+            std::ranges::stable_sort(entries, [&](const Entry& lhs, const Entry& rhs) {
+                return std::ranges::lexicographical_compare(key(lhs.path), key(rhs.path));
+            });
+
+            // the root node is nameless
+            m_offsets.push_back(0), m_types.push_back(Archetype::INVALID);
+            std::vector<uint32_t> parents = { s_none }, stack = { 0 };
+
+            // insert each path in pre-order, sharing the segments already on the stack
+            for (const auto& entry : entries) {
+                size_t depth = 1;
+                for (auto segment : m_segments(entry.path)) {
+                    if (depth < stack.size() && m_name(stack[depth]) == segment) {
+                        depth += 1;
+                        continue;
+                    }
+
+                    // otherwise this segment starts a new node
+                    stack.resize(depth);
+                    parents.push_back(stack.back()), stack.push_back(uint32_t(m_offsets.size()));
+                    m_offsets.push_back(m_names.size()), m_types.push_back(Archetype::INVALID), m_names.append(segment);
+                    depth += 1;
+                }
+
+                // and type the final node (which is now indexed)
+                stack.resize(depth);
+                if (depth > 1 && std::exchange(m_types[stack.back()], entry.type) == Archetype::INVALID) m_size += 1;
+            }
+
+            // finally lay the children out contiguously (a stable counting sort keeps them sorted by name)
+            m_first.assign(m_offsets.size() + 1, 0), m_children.resize(m_offsets.size() - 1);
+            for (size_t node = 1; node < parents.size(); ++node) m_first[parents[node] + 1] += 1;
+            for (size_t node = 1; node < m_first.size(); ++node) m_first[node] += m_first[node - 1];
+
+            // place each child after its earlier siblings
+            auto cursors = std::vector<uint32_t>(m_first.begin(), m_first.end() - 1);
+            for (size_t node = 1; node < parents.size(); ++node) m_children[cursors[parents[node]]++] = uint32_t(node);
+        }
+
+        /**
+         * @brief Splits a path into its segments (a leading separator yields an empty root segment).
+         * @param path                  Path to split.
+         */
+        static inline constexpr std::vector<std::string_view> m_segments(std::string_view path) {
+            std::vector<std::string_view> segments = {};
+            for (size_t start = 0; start <= path.size();) {
+                auto ending = std::min(path.find_first_of(Detail::separator(), start), path.size());
+                auto segment = path.substr(start, ending - start);
+                if (segment.size() || start == 0) segments.emplace_back(segment);
+                start = ending + 1;
+            }
+
+            // empty paths have no segments at all
+            if (segments.size() == 1 && segments.front().empty()) segments.clear();
+            return segments;
+        }
+
+        /**
+         * @brief Handles converting paths into regular file entries.
+         * @param paths                 Paths to convert.
+         */
+        template <typename Paths>
+        static inline constexpr std::vector<Entry> m_entries(const Paths& paths) {
+            std::vector<Entry> entries = {};
+            for (const auto& path : paths) entries.emplace_back(std::string(path), Archetype::REGULAR);
+            return entries;
+        }
+
+        /**
+         * @brief Handles collecting the entries of a walk.
+         * @param walker                Walker to collect the matches of.
+         * @param options               Iteration options.
+         * @param backend               Traversal backend.
+         */
+        template <Backend Source>
+        static inline constexpr std::vector<Entry> m_walk(
+            const Walker& walker, const Options& options, const Source& backend) {
+            std::vector<Entry> entries = {};
+            auto prefix = walker.pattern().absolute() ? 0 : options.cwd.size() + 1;
+            walker.visit(options, [&](const Entry& entry) {
+                entries.emplace_back(entry.path.substr(std::min(prefix, entry.path.size())), entry.type);
+            }, backend);
+            return entries;
+        }
+
+        /// @brief Denotes an absent node.
+        static constexpr uint32_t s_none = uint32_t(-1);
+    };
+
+}  // namespace Aster
+
+#endif
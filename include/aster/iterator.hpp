@@ -4,64 +4,86 @@
 /// C++ Includes
 #include <iterator>
 #include <memory>
+#include <type_traits>
 
 /// Aster Includes
-#include "aster/pattern.hpp"
-
-/// OS Includes
-#include "aster/unix/traversal.hpp"
-#include "aster/win32/traversal.hpp"
+#include "aster/backend.hpp"
+#include "aster/budget.hpp"
+#include "aster/filter.hpp"
+#include "aster/pending.hpp"
+#include "aster/snapshot.hpp"
+#include "aster/statistics.hpp"
+#include "aster/trace.hpp"
 
 namespace Aster {
 
-    /// @brief Traversal Options.
-    struct Options {
-        //  PROPERTIES  //
-
-        bool files = true;         // Allow matching files.
-        bool hidden = false;       // Allow matching hidden.
-        bool symlinks = false;     // Allow matching symlinks.
-        bool directories = false;  // Allow matching directories.
-
-        /// @brief The current working directory.
-        std::string cwd = Detail::getcwd();
+    /// @brief Visitor Actions.
+    enum class Visit : uint8_t {
+        CONTINUE,  // keep walking
+        SKIP,      // skip the visited directories contents
+        STOP,      // stop the walk immediately
     };
 
-    /// @brief Glob Pattern Iterator.
-    class Iterator {
+    /**
+     * @brief Glob Pattern Iterator.
+     * @tparam Source               Traversal backend (the real filesystem by default).
+     */
+    template <Backend Source = Detail::System>
+    class BasicIterator {
         //  PROPERTIES  //
 
         /// @brief Iterator options.
         Options m_options = Options();
 
-        /// @brief Associated glob pattern.
-        const Pattern* m_pattern = nullptr;
+        /// @brief Associated traversal backend.
+        Source m_backend = {};
+
+        /// @brief Associated entry filter.
+        Detail::Filter m_filter = {};
 
         /// @brief The pending directories queue.
-        std::vector<std::string> m_pending = {};
+        Detail::Pending m_pending = {};
 
         /// @brief Encapsulated traversal implementation.
         std::shared_ptr<Detail::Traversal> m_traversal = nullptr;
 
+        /// @brief Suspended parent traversals (for sorted walks).
+        std::vector<std::shared_ptr<Detail::Traversal>> m_suspended = {};
+
+        /// @brief Open directory traces (innermost last, only whilst tracing).
+        std::vector<Trace> m_traces = {};
+
        public:
         //  CONSTRUCTORS  //
 
         /// @brief Constructs a sentinel iterator value.
-        constexpr Iterator(std::default_sentinel_t) {}
+        constexpr BasicIterator(std::default_sentinel_t) {}
 
         /**
          * @brief Constructs a glob-iterator.
          * @param options               Iterator options.
          */
-        constexpr Iterator(const Options& options = {}) : Iterator(m_dynamic(), options) {}
+        constexpr BasicIterator(const Options& options = {}) : BasicIterator(m_dynamic(), options) {}
 
         /**
          * @brief Constructs a glob-iterator.
          * @param pattern               Glob pattern.
          * @param options               Iterator options.
+         * @param backend               Traversal backend.
          */
-        constexpr Iterator(const Pattern* pattern, const Options& options = {}) :
-            m_options(options), m_pattern(pattern), m_pending({ options.cwd }) {}
+        constexpr BasicIterator(const Pattern* pattern, const Options& options = {}, const Source& backend = {}) :
+            BasicIterator(std::span<const Pattern>(pattern, 1), options, backend) {}
+
+        /**
+         * @brief Constructs a multi-pattern glob-iterator.
+         * @param patterns              Glob patterns (at most `Detail::capacity()`).
+         * @param options               Iterator options.
+         * @param backend               Traversal backend.
+         */
+        explicit constexpr BasicIterator(
+            std::span<const Pattern> patterns, const Options& options = {}, const Source& backend = {}) :
+            m_options(options), m_backend(backend), m_filter(patterns, options),
+            m_pending(options.cwd, options.order, options.priority) {}
 
         //  OPERATOR METHODS  //
 
@@ -74,17 +96,46 @@ namespace Aster {
         }
 
         /// @brief Handles advancing the iterator.
-        inline constexpr Iterator& operator++() { return m_advance(), *this; }
+        inline constexpr BasicIterator& operator++() { return m_advance(), *this; }
 
         /// @brief Compares two iterator values if equal.
-        inline constexpr bool operator==(const Iterator& other) const noexcept {
+        inline constexpr bool operator==(const BasicIterator& other) const noexcept {
             return m_pending.empty() && m_traversal == other.m_traversal;
         }
 
         //  PUBLIC METHODS  //
 
-        inline constexpr Iterator begin() const noexcept { return *this; }
-        inline constexpr Iterator end() const noexcept { return Iterator(std::default_sentinel); }
+        inline constexpr BasicIterator begin() const noexcept { return *this; }
+        inline constexpr BasicIterator end() const noexcept { return BasicIterator(std::default_sentinel); }
+
+        /**
+         * @brief Pushes every remaining match to a visitor (without any iterator copies).
+         * @param visitor               Callback taking a `const Entry&` and returning a `Visit` action (or void).
+         * @note Returning `Visit::SKIP` for a directory prunes its contents (requires `Options::directories`), whereas
+         *       directories that never match are pruned through `Options::prune`.
+         * @returns False if the walk was stopped early.
+         */
+        template <typename Visitor>
+        inline constexpr bool visit(Visitor&& visitor) {
+            for (m_traversal ? void() : m_advance(); m_traversal != nullptr; m_advance()) {
+                const auto& entry = m_traversal->current();
+
+                // void visitors always continue
+                auto action = Visit::CONTINUE;
+                if constexpr (std::is_void_v<std::invoke_result_t<Visitor&, const Entry&>>) visitor(entry);
+                else action = visitor(entry);
+
+                // and handle the requested action now
+                switch (action) {
+                    case Visit::CONTINUE: break;
+                    case Visit::SKIP: m_prune(entry); break;
+                    case Visit::STOP: return m_stop(), false;
+                }
+            }
+
+            // the walk ran to completion
+            return true;
+        }
 
        private:
         //  PRIVATE METHODS  //
@@ -96,12 +147,15 @@ namespace Aster {
 
             // attempt scanning whilst possible to do so
             while (!m_traversal->done()) {
-                auto entry = m_traversal->advance();  // next
-                if (entry.path.size() && m_test(entry)) return;
+                auto& entry = m_read();  // next
+                if (entry.path.size() && (entry.mask = m_test(entry))) return;
+
+                // sorted walks descend into directories before any later siblings
+                if (m_sorted() && m_pending.size()) [[clang::musttail]] return m_advance();
             }
 
-            // if we reach here, clear the traversal now
-            m_traversal = nullptr;
+            // if we reach here, resume the parent traversal (if any)
+            m_close(), m_traversal = m_resume();
 
             // tail-call into advancing further now
             [[clang::musttail]] return m_advance();
@@ -109,47 +163,202 @@ namespace Aster {
 
         /// @brief Handles priming the traversal handler.
         inline constexpr bool m_prime() {
+            // sorted walks suspend the current listing whilst a child directory is walked
+            auto descend = m_sorted() && m_traversal != nullptr && m_pending.size();
+            if (descend) m_suspended.emplace_back(std::move(m_traversal));
+
             // if already primed, then
             if (m_traversal != nullptr) return true;
 
             // check if we have a pending value
             if (m_pending.empty()) return false;
 
-            // construct the next traversal
-            m_traversal = std::make_shared<Detail::Traversal>(m_pending.back());
+            // construct the next traversal (its path is rebuilt from the arena)
+            auto path = m_pending.pop();
+            m_record([&](Statistics& statistics) { statistics.bytes += Detail::heap(path); });
+            m_traversal = m_open(path);
+
+            // and declare as still running now (unless stopped)
+            return m_traversal != nullptr;
+        }
+
+        /**
+         * @brief Handles opening a directory traversal.
+         * @param path                  Directory path.
+         */
+        inline constexpr std::shared_ptr<Detail::Traversal> m_open(const std::string& path) {
+            for (auto start = Trace::Clock::now();;) {
+                auto traversal = m_list(path);
+                auto failed = bool(traversal->error());
+                m_record([&](Statistics& statistics) {
+                    ++(failed ? statistics.failed : statistics.opened);
+                    if (traversal->listing().shared()) return;  // copied as each entry is read instead
+
+                    // buffered listings hold a path per entry
+                    for (const auto& entry : traversal->listing().entries()) {
+                        statistics.bytes += Detail::heap(entry.path);
+                    }
+                });
+                if (!failed || !m_options.error) return m_trace(path, start, traversal);  // failures are skipped
+
+                // otherwise let the handler decide how to recover
+                switch (m_options.error(path, traversal->error())) {
+                    case Recovery::SKIP: return m_trace(path, start, traversal);
+                    case Recovery::RETRY: continue;
+                    case Recovery::STOP: return m_stop(), nullptr;
+                }
+            }
+        }
+
+        /**
+         * @brief Handles tracing an opened directory (when tracing).
+         * @param path                  Directory path.
+         * @param start                 When the directory started opening.
+         * @param traversal             Directory traversal.
+         */
+        inline constexpr std::shared_ptr<Detail::Traversal> m_trace(
+            const std::string& path, Trace::Clock::time_point start, std::shared_ptr<Detail::Traversal> traversal) {
+            if (!m_options.trace) return traversal;
+
+            // the open phase already includes the time spent opening
+            auto reading = Trace::Clock::now() - start;
+            auto& trace = m_traces.emplace_back(
+                Trace { .path = path, .error = traversal->error(), .reading = reading, .start = start });
+            return m_options.trace(trace), traversal;
+        }
+
+        /// @brief Handles tracing the innermost open directory closing.
+        inline constexpr void m_close() {
+            if (m_traces.empty()) return;  // not tracing
+            auto& trace = m_traces.back();
+            trace.phase = Phase::CLOSE, m_options.trace(trace), m_traces.pop_back();
+        }
+
+        /**
+         * @brief Handles listing a directory.
+         * @param path                  Directory path.
+         */
+        inline constexpr std::shared_ptr<Detail::Traversal> m_list(const std::string& path) {
+            auto stopwatch = Detail::Stopwatch(m_options.statistics, &Statistics::syscalls);
+            auto list = [&](bool buffered) {
+                auto budget = m_options.budget;  // budgeted listings are read in full whilst holding a handle
+                auto lease = budget ? budget->acquire() : Budget::Lease();
+                return std::shared_ptr<Detail::Traversal>(m_backend.open(path, m_options.sorting, buffered || budget));
+            };
+
+            // without snapshots (or real directories) always list directly
+            auto snapshot = std::same_as<Source, Detail::System> ? m_options.snapshot : nullptr;
+            if (snapshot == nullptr) return list(false);
+
+            // unstampable directories cannot be cached
+            auto stamp = Snapshot::stamp(path);
+            if (!stamp) return list(false);
+
+            // reuse the cached listing whilst the directory is unchanged
+            if (auto listing = snapshot->find(path, *stamp)) {
+                return std::make_shared<Detail::Traversal>(path, std::move(*listing), m_options.sorting);
+            }
+
+            // otherwise list the directory in full and record it (unless it failed to open)
+            auto traversal = list(true);
+            if (!traversal->error()) snapshot->record(path, *stamp, traversal->listing());
+            return traversal;
+        }
+
+        /**
+         * @brief Handles pruning a directory that was just queued.
+         * @param entry                 Directory entry.
+         */
+        inline constexpr void m_prune(const Entry& entry) {
+            if (entry.type != Archetype::DIRECTORY || !m_pending.queued(entry.path)) return;
+            m_pending.drop(), m_record([](Statistics& statistics) { statistics.pruned += 1; });
+        }
 
-            // and declare as still running now
-            return m_pending.pop_back(), true;
+        /// @brief Handles stopping the walk early.
+        inline constexpr void m_stop() {
+            m_pending.clear(), m_suspended.clear();
+            m_traversal = nullptr;  // closes the open directory
+            while (m_traces.size()) m_close();
+        }
+
+        /// @brief Handles resuming a suspended traversal.
+        inline constexpr std::shared_ptr<Detail::Traversal> m_resume() {
+            if (m_suspended.empty()) return nullptr;  // nothing left to resume
+
+            // take the most recently suspended traversal (the parent of the finished directory)
+            auto traversal = std::move(m_suspended.back());
+            return m_suspended.pop_back(), m_pending.close(), traversal;
+        }
+
+        /// @brief Denotes if the walk streams in sorted (depth-first) path order.
+        inline constexpr bool m_sorted() const noexcept {
+            return m_options.sorting != Sorting::NONE && m_options.order == Order::DEPTH;
         }
 
         /**
          * @brief Handles testing incoming entries.
          * @param entry                 Traversal entry.
          */
-        inline constexpr bool m_test(const Entry& entry) {
-            // hande the incoming entry typing
-            switch (entry.type) {
-                case Archetype::REGULAR: return m_options.files && m_test(entry.path);
-                case Archetype::SYMLINK: return m_options.symlinks && m_test(entry.path);
-                case Archetype::DIRECTORY: break;
-                default: return false;
+        inline constexpr Mask m_test(const Entry& entry) {
+            auto stopwatch = Detail::Stopwatch(m_options.statistics, &Statistics::matching);
+
+            // for directories we want to push when any pattern could descend
+            auto directory = entry.type == Archetype::DIRECTORY;
+            auto descend = directory && m_filter.descends(entry.path);
+            auto footprint = Statistics::enabled ? m_pending.bytes() : 0;
+            if (descend) m_pending.push(entry.path);
+
+            // and match against all the patterns now
+            auto mask = m_filter.test(entry);
+            if (mask && m_traces.size()) m_traces.back().matches += 1;
+            m_record([&](Statistics& statistics) {
+                statistics.tested += 1, statistics.matched += mask != 0, statistics.pruned += directory && !descend;
+                statistics.pending = std::max<uint64_t>(statistics.pending, m_pending.size());
+                statistics.bytes += m_pending.bytes() - std::min(m_pending.bytes(), footprint);  // arena growth
+            });
+
+            // resolve the matched patterns
+            return mask;
+        }
+
+        /// @brief Handles reading the next traversal entry.
+        inline constexpr Entry& m_read() {
+            auto stopwatch = Detail::Stopwatch(m_options.statistics, &Statistics::syscalls);
+            auto tracing = m_traces.size() != 0;
+            auto start = tracing ? Trace::Clock::now() : Trace::Clock::time_point();
+            auto listed = Statistics::enabled && m_traversal->listing().size() != 0;
+            auto shared = Statistics::enabled && m_traversal->listing().shared();
+            auto capacity = Statistics::enabled ? m_traversal->current().path.capacity() : 0;
+            auto& entry = m_traversal->advance();
+
+            // traces accumulate the time spent reading each directory
+            if (tracing) {
+                auto& trace = m_traces.back();
+                trace.reading += Trace::Clock::now() - start, trace.entries += entry.path.size() != 0;
             }
 
-            // for directories we want to push when the pattern is recursive
-            if (m_pattern->recursive()) m_pending.emplace_back(entry.path);
+            // skipped entries (such as "." and "..") have no path
+            m_record([&](Statistics& statistics) {
+                if (entry.path.size()) statistics.entries += 1, statistics.types[size_t(entry.type)] += 1;
 
-            // and match only if directories can be matched
-            return m_options.directories && m_test(entry.path);
+                // shared listings copy each entry, whereas streamed entries only regrow the reused path buffer
+                if (listed && shared) statistics.bytes += Detail::heap(entry.path);
+                else if (!listed && entry.path.capacity() > capacity) statistics.bytes += Detail::heap(entry.path);
+            });
+
+            // resolve the read entry
+            return entry;
         }
 
         /**
-         * @brief Handles testing incoming paths.
-         * @param input                 Input path.
+         * @brief Handles recording walk statistics (compiled away unless `ASTER_STATISTICS_ENABLED`).
+         * @param recorder              Callback taking the `Statistics&` to update.
          */
-        inline constexpr bool m_test(std::string_view input) const noexcept {
-            if (!m_pattern->absolute()) input.remove_prefix(m_options.cwd.size() + 1);
-            if (!m_options.hidden && input.starts_with('.')) return false;
-            return m_pattern->matches(input);  // check if the input matches now
+        template <typename Recorder>
+        inline constexpr void m_record(Recorder&& recorder) const {
+            if constexpr (Statistics::enabled) {
+                if (m_options.statistics != nullptr) recorder(*m_options.statistics);
+            }
         }
 
         /// @brief Gets the underlying dynamic pattern.
@@ -159,6 +368,9 @@ namespace Aster {
         }
     };
 
+    /// @brief Filesystem Glob Pattern Iterator.
+    using Iterator = BasicIterator<>;
+
     /// @brief Ending Iterator.
     struct Sentinel : public Iterator {
         //  CONSTRUCTORS  //
@@ -0,0 +1,112 @@
+#ifndef _ASTER_LISTING_HPP
+#define _ASTER_LISTING_HPP
+
+/// C++ Includes
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <vector>
+
+/// Aster Includes
+#include "aster/entry.hpp"
+
+namespace Aster::Detail {
+
+    /// @brief Buffered Directory Listing.
+    class Listing {
+        //  PROPERTIES  //
+
+        /// @brief Buffered entries.
+        std::vector<Entry> m_entries = {};
+
+        /// @brief Shared entries served in place (copied only once pushed to or sorted).
+        std::shared_ptr<const std::vector<Entry>> m_shared = nullptr;
+
+        /// @brief Index of the next entry to serve.
+        size_t m_cursor = 0;
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /// @brief Constructs an empty listing.
+        constexpr Listing() = default;
+
+        /**
+         * @brief Constructs a listing serving shared entries (without copying them upfront).
+         * @param shared                Shared entries (left unchanged whilst served).
+         */
+        explicit constexpr Listing(std::shared_ptr<const std::vector<Entry>> shared) : m_shared(std::move(shared)) {}
+
+        //  PUBLIC METHODS  //
+
+        /// @brief Denotes if the listing has been exhausted.
+        inline constexpr bool empty() const noexcept { return m_cursor == m_source().size(); }
+
+        /// @brief Denotes if shared entries are served in place (so each is copied as it is taken).
+        inline constexpr bool shared() const noexcept { return m_shared != nullptr; }
+
+        /// @brief Gets the number of remaining entries.
+        inline constexpr size_t size() const noexcept { return m_source().size() - m_cursor; }
+
+        /// @brief Gets the remaining entries.
+        inline constexpr std::span<const Entry> entries() const noexcept {
+            return std::span<const Entry>(m_source()).subspan(m_cursor);
+        }
+
+        /**
+         * @brief Buffers an incoming entry.
+         * @param entry                 Entry to buffer.
+         */
+        inline constexpr void push(Entry&& entry) { m_own(), m_entries.emplace_back(std::move(entry)); }
+
+        /// @brief Takes the next entry (or an empty entry when exhausted).
+        inline constexpr Entry pop() {
+            if (empty()) return Entry();
+            return m_shared ? Entry((*m_shared)[m_cursor++]) : std::move(m_entries[m_cursor++]);
+        }
+
+        /**
+         * @brief Sorts the remaining entries.
+         * @param sorting               Sorting order.
+         */
+        inline constexpr void sort(Sorting sorting) {
+            if (sorting == Sorting::NONE) return;  // left as listed (so shared entries stay shared)
+
+            m_own();
+            auto remaining = std::span<Entry>(m_entries).subspan(m_cursor);
+            switch (sorting) {
+                case Sorting::BYTEWISE: std::ranges::sort(remaining, std::ranges::less(), &Entry::path); break;
+                case Sorting::NATURAL: std::ranges::sort(remaining, m_natural); break;
+                default: break;
+            }
+        }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /// @brief Gets the entries being served.
+        inline constexpr const std::vector<Entry>& m_source() const noexcept {
+            return m_shared ? *m_shared : m_entries;
+        }
+
+        /// @brief Handles copying any remaining shared entries (so they may be changed).
+        inline constexpr void m_own() {
+            if (m_shared == nullptr) return;
+            m_entries.assign(m_shared->begin() + ptrdiff_t(m_cursor), m_shared->end());
+            m_shared = nullptr, m_cursor = 0;
+        }
+
+        /**
+         * @brief Natural comparison (ties broken byte-wise).
+         * @param lhs                   Left-hand entry.
+         * @param rhs                   Right-hand entry.
+         */
+        static inline constexpr bool m_natural(const Entry& lhs, const Entry& rhs) noexcept {
+            auto order = Detail::natural(lhs.path, rhs.path);
+            return order ? order < 0 : lhs.path < rhs.path;
+        }
+    };
+
+}  // namespace Aster::Detail
+
+#endif
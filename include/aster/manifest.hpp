@@ -0,0 +1,197 @@
+#ifndef _ASTER_MANIFEST_HPP
+#define _ASTER_MANIFEST_HPP
+
+/// C++ Includes
+#include <algorithm>
+#include <concepts>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+/// Aster Includes
+#include "aster/content.hpp"
+#include "aster/pattern.hpp"
+
+namespace Aster {
+
+    /// @brief Memory-Mapped Path Manifest (filtered in parallel, with matches kept in input order).
+    class Manifest {
+        //  TYPEDEFS  //
+
+        /// @brief Matches of a single chunk (views into the mapping).
+        struct Chunk {
+            std::vector<std::string_view> matches = {};
+            bool ready = false;
+        };
+
+        //  PROPERTIES  //
+
+        /// @brief Mapped manifest content.
+        Content m_content = {};
+
+        /// @brief Path delimiter ('\n' or '\0').
+        char m_delimiter = '\n';
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /// @brief Constructs an empty manifest.
+        constexpr Manifest() = default;
+
+        /**
+         * @brief Opens a manifest file (mapped on first use).
+         * @param path                  Manifest path.
+         * @param delimiter             Path delimiter ('\n' or '\0'), carriage returns ending lines are ignored.
+         */
+        explicit constexpr Manifest(const std::string& path, char delimiter = '\n') :
+            m_content(path), m_delimiter(delimiter) {}
+
+        //  PUBLIC METHODS  //
+
+        /// @brief Gets the manifest content (empty if it could not be read).
+        inline constexpr std::string_view view() { return m_content.view(); }
+
+        /**
+         * @brief Pushes every matching path to a sink, in input order.
+         * @param pattern               Pattern to match.
+         * @param sink                  Callback taking each matching `std::string_view` (on the calling thread).
+         * @param threads               Matching threads (the hardware concurrency when zero).
+         * @param chunk                 Approximate bytes per chunk (split at delimiters).
+         * @returns The number of matching paths.
+         */
+        template <std::invocable<std::string_view> Sink>
+        inline size_t filter(const Pattern& pattern, Sink&& sink, size_t threads = 0, size_t chunk = 1 << 22) {
+            auto chunks = m_split(view(), std::max<size_t>(chunk, 1));
+            threads = std::min(threads ? threads : std::max<size_t>(std::thread::hardware_concurrency(), 1),
+                               chunks.size());
+
+            // small manifests (or single threads) are matched inline
+            size_t count = 0;
+            if (threads <= 1) {
+                for (auto part : chunks) m_match(pattern, part, [&](std::string_view path) { ++count, sink(path); });
+                return count;
+            }
+
+            // otherwise workers claim chunks within a bounded window (so memory stays proportional to threads)
+            auto window = threads * 4, next = size_t(0), emitted = size_t(0);
+            auto results = std::vector<Chunk>(window);
+            auto stopped = false;
+            std::mutex mutex = {};
+            std::condition_variable signal = {};
+            auto work = [&] {
+                for (;;) {
+                    auto lock = std::unique_lock(mutex);
+                    signal.wait(lock, [&] { return stopped || next >= chunks.size() || next < emitted + window; });
+                    if (stopped || next >= chunks.size()) return;
+                    auto index = next++;
+                    lock.unlock();
+
+                    // match outside the lock (views keep the matches zero-copy)
+                    auto matches = std::vector<std::string_view>();
+                    m_match(pattern, chunks[index], [&](std::string_view path) { matches.push_back(path); });
+
+                    // and publish the chunk now
+                    lock.lock(), results[index % window] = { std::move(matches), true };
+                    signal.notify_all();
+                }
+            };
+
+            auto workers = std::vector<std::jthread>();
+            for (size_t index = 0; index < threads; ++index) workers.emplace_back(work);
+
+            // emit each chunk in order as it becomes ready
+            try {
+                for (size_t index = 0; index < chunks.size(); ++index) {
+                    auto matches = std::vector<std::string_view>();
+                    {
+                        auto lock = std::unique_lock(mutex);
+                        auto& result = results[index % window];
+                        signal.wait(lock, [&] { return result.ready; });
+                        matches = std::move(result.matches), result = {}, emitted = index + 1;
+                    }
+
+                    signal.notify_all();
+                    for (auto path : matches) ++count, sink(path);
+                }
+            } catch (...) {
+                // stop the workers before rethrowing (they reference this frame)
+                {
+                    auto lock = std::scoped_lock(mutex);
+                    stopped = true;
+                }
+
+                signal.notify_all(), workers.clear();
+                throw;
+            }
+
+            // resolve the number of matches
+            return count;
+        }
+
+        /**
+         * @brief Writes every matching path to a stream (each followed by the delimiter), in input order.
+         * @param pattern               Pattern to match.
+         * @param output                Stream to write to.
+         * @param threads               Matching threads (the hardware concurrency when zero).
+         * @returns The number of matching paths.
+         */
+        inline size_t filter(const Pattern& pattern, std::ostream& output, size_t threads = 0) {
+            return filter(pattern, [&](std::string_view path) { output << path << m_delimiter; }, threads);
+        }
+
+        /**
+         * @brief Counts the matching paths.
+         * @param pattern               Pattern to match.
+         * @param threads               Matching threads (the hardware concurrency when zero).
+         */
+        inline size_t count(const Pattern& pattern, size_t threads = 0) {
+            return filter(pattern, [](std::string_view) {}, threads);
+        }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /**
+         * @brief Splits content into chunks ending at delimiters.
+         * @param content               Content to split.
+         * @param size                  Approximate bytes per chunk.
+         */
+        inline constexpr std::vector<std::string_view> m_split(std::string_view content, size_t size) const {
+            std::vector<std::string_view> chunks = {};
+            while (content.size()) {
+                // extend each chunk to the next delimiter (so no path spans two chunks)
+                auto ending = content.size() > size ? content.find(m_delimiter, size) : content.npos;
+                ending = ending == content.npos ? content.size() : ending + 1;
+                chunks.push_back(content.substr(0, ending)), content.remove_prefix(ending);
+            }
+
+            // resolve the chunks
+            return chunks;
+        }
+
+        /**
+         * @brief Matches each path within a chunk.
+         * @param pattern               Pattern to match.
+         * @param chunk                 Chunk to match.
+         * @param matched               Callback taking each matching path.
+         */
+        template <typename Matched>
+        inline constexpr void m_match(const Pattern& pattern, std::string_view chunk, Matched&& matched) const {
+            while (chunk.size()) {
+                auto ending = std::min(chunk.find(m_delimiter), chunk.size());
+                auto path = chunk.substr(0, ending);
+                chunk.remove_prefix(std::min(ending + 1, chunk.size()));
+
+                // ignore carriage returns of newline-delimited paths (and empty lines)
+                if (m_delimiter == '\n' && path.ends_with('\r')) path.remove_suffix(1);
+                if (path.size() && pattern.matches(path)) matched(path);
+            }
+        }
+    };
+
+}  // namespace Aster
+
+#endif
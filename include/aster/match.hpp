@@ -3,6 +3,8 @@
 
 /// C++ Includes
 #include <algorithm>
+#include <array>
+#include <span>
 #include <vector>
 
 /// Aster Incldues
@@ -10,6 +12,71 @@
 
 namespace Aster {
 
+    /// @brief Available Matching Modes.
+    enum class Matching : uint8_t {
+        BACKTRACKING,  // fastest on typical globs
+        LINEAR,        // guaranteed O(|glob| * |input|) time (for untrusted globs)
+    };
+
+    /// @brief Wildcard Capture Spans (views into the matched input, stored inline for the first few).
+    class Captures {
+        //  PROPERTIES  //
+
+        /// @brief Inline captures.
+        std::array<std::string_view, 8> m_inline = {};
+
+        /// @brief Captures beyond the inline capacity.
+        std::vector<std::string_view> m_spilled = {};
+
+        /// @brief Number of captures.
+        size_t m_size = 0;
+
+        /// @brief Denotes if the input matched.
+        bool m_matched = false;
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /// @brief Constructs an unmatched result.
+        constexpr Captures() = default;
+
+        //  OPERATOR METHODS  //
+
+        /// @brief Denotes if the input matched.
+        inline constexpr explicit operator bool() const noexcept { return m_matched; }
+
+        /**
+         * @brief Gets a capture (a null view for wildcards within brace alternatives that were not taken).
+         * @param index             Capture index (in glob order).
+         */
+        inline constexpr std::string_view operator[](size_t index) const noexcept {
+            return index < m_inline.size() ? m_inline[index] : m_spilled[index - m_inline.size()];
+        }
+
+        //  PUBLIC METHODS  //
+
+        /// @brief Gets the number of captures.
+        inline constexpr size_t size() const noexcept { return m_size; }
+
+        /**
+         * @brief Appends a capture.
+         * @param capture           Captured span.
+         */
+        inline constexpr void push(std::string_view capture) {
+            if (m_size < m_inline.size()) m_inline[m_size] = capture;
+            else m_spilled.push_back(capture);
+            m_size += 1;
+        }
+
+        /**
+         * @brief Resets the captures.
+         * @param matched           Matched state.
+         */
+        inline constexpr void reset(bool matched = false) noexcept {
+            m_spilled.clear(), m_size = 0, m_matched = matched;
+        }
+    };
+
     /// @brief Handlers pattern matching.
     class Match {
         //  TYPEDEFS  //
@@ -51,6 +118,37 @@ namespace Aster {
             uint32_t braces = 0;
         };
 
+        /// @brief Automaton State Kinds (for linear matching).
+        enum class Kind : uint8_t {
+            CHAR,      // a single character ('/' matching any separator)
+            ANY,       // '?' (any non-separator)
+            CLASS,     // '[...]' (any non-separator within the ranges)
+            STAR,      // '*' (any non-separators)
+            GLOBSTAR,  // '**/' (any characters, left only at segment boundaries)
+            SPLIT,     // '{...}' (all alternatives at once)
+            JUMP,      // end of a brace alternative
+            ACCEPT,    // the glob was consumed
+        };
+
+        /// @brief Automaton State.
+        struct Node {
+            Kind kind = Kind::ACCEPT;
+            char ch = 0;           // CHAR value (or a globstars trailing separator)
+            bool negated = false;  // CLASS negation
+            uint32_t begin = 0;    // CLASS ranges (or SPLIT edges) start
+            uint32_t end = 0;      // CLASS ranges (or SPLIT edges) ending
+            uint32_t next = 0;     // following state
+        };
+
+        /// @brief Compiled Glob Automaton.
+        struct Automaton {
+            std::vector<Node> nodes = {};
+            std::vector<uint32_t> edges = {};
+            std::vector<std::pair<char, char>> ranges = {};
+            std::vector<uint32_t> pending = {};  // scratch states whilst entering
+            bool valid = true;
+        };
+
         //  PROPERTIES  //
 
         Wildcard m_state = {};     // Baseline matching state.
@@ -60,6 +158,18 @@ namespace Aster {
         /// @brief The pending braces stack.
         Stack* m_pending = nullptr;
 
+        /// @brief Input positions where each glob index was last consumed (when capturing).
+        uint32_t* m_marks = nullptr;
+
+        /// @brief Alternative taken by each brace (indexed by its opening, directly following the marks).
+        uint32_t* m_choices = nullptr;
+
+        /// @brief Denotes if the next glob index resumes a wildcard (keeping its original mark).
+        bool m_resumed = false;
+
+        /// @brief Unset mark value.
+        static constexpr uint32_t s_unset = UINT32_MAX;
+
         //  CONSTRUCTORS  //
 
         /// @brief Constructs a matcher instance.
@@ -94,6 +204,38 @@ namespace Aster {
             return negated ^ matcher.m_matches_pattern(glob, input, 0);
         }
 
+        /**
+         * @brief Handles matching globbing patterns, capturing the span of each wildcard.
+         * @param glob              Pattern to consume.
+         * @param input             Input to validate (which the captures view).
+         * @param captures          Captures of each `*`, `**`, `?`, bracket and brace (in glob order).
+         * @note Globstar captures exclude their trailing separator, and negated globs capture nothing.
+         */
+        static inline constexpr bool captures(std::string_view glob, const std::string_view& input,
+                                              Captures& captures) {
+            if (glob.empty()) return captures.reset(input.empty()), input.empty();
+
+            // prepare the details to be used
+            auto pending = Stack();
+            auto matcher = Match(&pending);
+            auto negated = matcher.m_negate_pattern(glob);
+
+            // marks live inline for typical globs
+            std::array<uint32_t, 256> inlined;
+            std::vector<uint32_t> spilled = {};
+            auto marks = glob.size() * 2 <= inlined.size() ? std::span(inlined).first(glob.size() * 2)
+                                                            : (spilled.resize(glob.size() * 2), std::span(spilled));
+            std::ranges::fill(marks, s_unset);
+            matcher.m_marks = marks.data(), matcher.m_choices = marks.data() + glob.size();
+
+            // match once (recording marks) and then resolve the spans from them
+            auto matched = negated ^ matcher.m_matches_pattern(glob, input, 0);
+            captures.reset(matched);
+            auto size = glob.size();
+            if (matched && !negated) m_capture(glob, input, marks.first(size), marks.subspan(size, size), captures);
+            return matched;
+        }
+
         /**
          * @brief Handles matching empty patterns.
          * @param glob              Ignored pattern.
@@ -119,9 +261,244 @@ namespace Aster {
             return input.ends_with(glob.substr(glob.find_last_of('*') + 1));
         }
 
+        /**
+         * @brief Handles matching globbing patterns in guaranteed O(|glob| * |input|) time.
+         * @param glob              Pattern to consume.
+         * @param input             Input to validate.
+         * @note Simulates every glob position at once (instead of backtracking), so adversarial stars and braces
+         *       cannot blow up; malformed globs never match.
+         */
+        static inline constexpr bool linear(std::string_view glob, const std::string_view& input) {
+            auto negated = Match().m_negate_pattern(glob);
+            auto automaton = Automaton();
+
+            // compile the automaton (ensuring any braces were closed)
+            auto index = m_compile(automaton, glob, 0, 0);
+            automaton.nodes.emplace_back();  // accept at the end
+            if (!automaton.valid || index != glob.size()) return negated;
+
+            // the active states for each input position (stamped to skip duplicates)
+            std::vector<uint32_t> current = {}, next = {}, stamps(automaton.nodes.size(), 0);
+            m_enter(automaton, input, 0, 0, current, stamps);
+
+            // advance every active state over each character
+            for (uint32_t position = 0; position < input.size() && current.size(); ++position) {
+                auto ch = input[position];
+                for (auto state : current) {
+                    const auto& node = automaton.nodes[state];
+                    switch (node.kind) {
+                        case Kind::CHAR: {
+                            if (node.ch == '/' ? !Detail::separator(ch) : node.ch != ch) continue;
+                            m_enter(automaton, input, node.next, position + 1, next, stamps);
+                        } break;
+
+                        case Kind::ANY:
+                        case Kind::STAR: {
+                            if (Detail::separator(ch)) continue;
+                            auto target = node.kind == Kind::STAR ? state : node.next;
+                            m_enter(automaton, input, target, position + 1, next, stamps);
+                        } break;
+
+                        case Kind::CLASS: {
+                            if (Detail::separator(ch)) continue;
+                            auto ranges = std::span(automaton.ranges).subspan(node.begin, node.end - node.begin);
+                            auto within = std::ranges::any_of(ranges, [&](const auto& range) {
+                                return range.first <= ch && ch <= range.second;
+                            });
+                            if (within == node.negated) continue;
+                            m_enter(automaton, input, node.next, position + 1, next, stamps);
+                        } break;
+
+                        case Kind::GLOBSTAR: m_enter(automaton, input, state, position + 1, next, stamps); break;
+                        default: break;  // non-consuming states
+                    }
+                }
+
+                // and swap over to the next positions states
+                std::swap(current, next), next.clear();
+            }
+
+            // the input matches if the glob could be fully consumed
+            auto accepted = std::ranges::any_of(current, [&](uint32_t state) {
+                return automaton.nodes[state].kind == Kind::ACCEPT;
+            });
+
+            // and resolve with the expected negation
+            return negated != accepted;
+        }
+
        private:
         //  PRIVATE METHODS  //
 
+        /**
+         * @brief Handles compiling a glob sequence into automaton states (stopping at a brace delimiter).
+         * @param automaton         Automaton to extend.
+         * @param glob              Pattern to compile.
+         * @param index             Starting glob index.
+         * @param depth             Current brace depth.
+         * @returns The index the sequence stopped at.
+         */
+        static inline constexpr size_t m_compile(
+            Automaton& automaton, std::string_view glob, size_t index, size_t depth) {
+            auto& nodes = automaton.nodes;
+            for (auto start = index; index < glob.size() && automaton.valid;) {
+                auto ch = glob[index];
+                auto node = Node { .kind = Kind::CHAR, .ch = ch, .next = uint32_t(nodes.size() + 1) };
+
+                switch (ch) {
+                    case Action::BRACE_CLOSE:
+                    case Action::BRACE_COMMA: {
+                        if (depth) return index;  // ends the alternative
+                        index += 1;
+                    } break;
+
+                    case Action::WILD_QUERY: node.kind = Kind::ANY, index += 1; break;
+                    case Action::WILD_ESCAPE: {
+                        automaton.valid = m_character(glob, index, node.ch);
+                    } break;
+
+                    case Action::WILD_STAR: {
+                        // only whole segment globstars may cross separators
+                        auto stars = glob.substr(index).starts_with("**");
+                        auto leading = index == start || Detail::separator(glob[index - 1]);
+                        auto trailing = index + 2 == glob.size() || (stars && Detail::separator(glob[index + 2]));
+                        node.kind = stars && leading && trailing ? Kind::GLOBSTAR : Kind::STAR;
+
+                        // consume the stars (along with a globstars trailing separator)
+                        auto separated = node.kind == Kind::GLOBSTAR && index + 2 < glob.size();
+                        index += stars ? 2 + separated : 1, node.ch = separated ? '/' : 0;
+                    } break;
+
+                    case Action::BRACK_OPEN: {
+                        node.kind = Kind::CLASS, index = m_bracket(automaton, glob, index + 1, node);
+                    } break;
+
+                    case Action::BRACE_OPEN: {
+                        // each alternative is compiled in turn, jumping past the braces once done
+                        node.kind = Kind::SPLIT;
+                        auto split = nodes.size();
+                        std::vector<uint32_t> alternatives = {}, jumps = {};
+                        nodes.emplace_back(node);
+
+                        do {
+                            alternatives.push_back(uint32_t(nodes.size()));
+                            index = m_compile(automaton, glob, index + 1, depth + 1);
+                            jumps.push_back(uint32_t(nodes.size())), nodes.push_back({ .kind = Kind::JUMP });
+                        } while (index < glob.size() && glob[index] == Action::BRACE_COMMA);
+
+                        // unclosed braces can never match
+                        if (index >= glob.size()) return automaton.valid = false, index;
+                        for (auto jump : jumps) nodes[jump].next = uint32_t(nodes.size());
+
+                        // and record the alternatives of the split
+                        nodes[split].begin = uint32_t(automaton.edges.size());
+                        automaton.edges.insert(automaton.edges.end(), alternatives.begin(), alternatives.end());
+                        nodes[split].end = uint32_t(automaton.edges.size());
+                        index += 1;
+                        continue;
+                    }
+
+                    default: index += 1; break;
+                }
+
+                // append the compiled state now
+                nodes.emplace_back(node);
+            }
+
+            // the whole glob was consumed
+            return index;
+        }
+
+        /**
+         * @brief Handles compiling a bracket expression (after its opening bracket).
+         * @param automaton         Automaton to extend.
+         * @param glob              Pattern to compile.
+         * @param index             Index after the opening bracket.
+         * @param node              Class state to fill in.
+         * @returns The index after the closing bracket.
+         */
+        static inline constexpr size_t m_bracket(
+            Automaton& automaton, std::string_view glob, size_t index, Node& node) {
+            node.negated = index < glob.size() && (glob[index] == '!' || glob[index] == '^');
+            node.begin = uint32_t(automaton.ranges.size()), index += node.negated;
+
+            // a leading closing bracket is taken literally
+            for (auto first = true; index < glob.size() && (first || glob[index] != ']'); first = false) {
+                char low = glob[index], high = 0;
+                if (automaton.valid = m_character(glob, index, low); !automaton.valid) return index;
+
+                // ranges need a non-closing upper bound
+                high = low;
+                if (index + 1 < glob.size() && glob[index] == '-' && glob[index + 1] != ']') {
+                    high = glob[index += 1];
+                    if (automaton.valid = m_character(glob, index, high); !automaton.valid) return index;
+                }
+
+                // record the range now
+                automaton.ranges.emplace_back(low, high);
+            }
+
+            // unclosed brackets can never match
+            node.end = uint32_t(automaton.ranges.size());
+            if (index >= glob.size()) automaton.valid = false;
+            return index + 1;
+        }
+
+        /**
+         * @brief Handles reading a (possibly escaped) glob character.
+         * @param glob              Pattern to read.
+         * @param index             Character index (advanced past it).
+         * @param ch                Resulting character.
+         * @returns False if a trailing escape has nothing to escape.
+         */
+        static inline constexpr bool m_character(std::string_view glob, size_t& index, char& ch) {
+            auto matcher = Match();
+            matcher.m_state.glob = uint32_t(index), ch = glob[index];
+            if (!matcher.m_unescape(glob, ch)) return false;
+            return index = matcher.m_state.glob + 1, true;
+        }
+
+        /**
+         * @brief Handles entering a state (along with every state reachable without consuming input).
+         * @param automaton         Compiled automaton.
+         * @param input             Input being matched.
+         * @param state             State to enter.
+         * @param position          Input position.
+         * @param active            Active states to extend.
+         * @param stamps            Position stamps of the entered states.
+         */
+        static inline constexpr void m_enter(Automaton& automaton, const std::string_view& input, uint32_t state,
+                                             uint32_t position, std::vector<uint32_t>& active,
+                                             std::vector<uint32_t>& stamps) {
+            auto& pending = automaton.pending;
+            for (pending.assign(1, state); pending.size();) {
+                auto current = pending.back();
+                pending.pop_back();
+
+                // only enter each state once per position
+                if (stamps[current] == position + 1) continue;
+                stamps[current] = position + 1;
+
+                const auto& node = automaton.nodes[current];
+                switch (node.kind) {
+                    case Kind::SPLIT: {
+                        auto edges = std::span(automaton.edges).subspan(node.begin, node.end - node.begin);
+                        pending.insert(pending.end(), edges.rbegin(), edges.rend());
+                    } break;
+
+                    case Kind::JUMP: pending.push_back(node.next); break;
+                    case Kind::STAR: active.push_back(current), pending.push_back(node.next); break;
+                    case Kind::GLOBSTAR: {
+                        // separated globstars only give way at the start of a segment
+                        auto boundary = !node.ch || position == 0 || Detail::separator(input[position - 1]);
+                        if (active.push_back(current); boundary) pending.push_back(node.next);
+                    } break;
+
+                    default: active.push_back(current); break;
+                }
+            }
+        }
+
         /**
          * @brief Gets the expected negation of a pattern.
          * @param glob              Pattern to negate.
@@ -131,6 +508,105 @@ namespace Aster {
             return glob.remove_prefix(index), index % 2;  // and resolve
         }
 
+        /**
+         * @brief Resolves the captures of a successful match from its marks.
+         * @param glob              Matched glob (without negations).
+         * @param input             Matched input.
+         * @param marks             Input positions where each glob index was consumed.
+         * @param choices           Alternative taken by each brace.
+         * @param captures          Captures to append to.
+         */
+        static inline constexpr void m_capture(std::string_view glob, std::string_view input,
+                                               std::span<const uint32_t> marks, std::span<const uint32_t> choices,
+                                               Captures& captures) {
+            // captures end wherever the following glob index was consumed
+            auto ending = [&](size_t index) -> size_t {
+                for (; index < glob.size(); ++index) {
+                    if (marks[index] != s_unset) return marks[index];
+                }
+
+                return input.size();  // trailing wildcards consume the rest
+            };
+
+            // each enclosing brace holds its opening and the current alternatives start
+            std::vector<std::pair<uint32_t, uint32_t>> braces = {};
+            auto capture = [&](size_t begin, size_t end, bool globstar) {
+                auto taken = std::ranges::all_of(braces, [&](auto& pair) {
+                    return choices[pair.first] == pair.second;
+                });
+                if (!taken || marks[begin] == s_unset) return captures.push({});
+
+                // globstars exclude any trailing separator they consumed
+                auto from = size_t(marks[begin]), to = std::max(from, ending(end));
+                auto span = input.substr(from, to - from);
+                if (globstar && span.size() && end < glob.size() && glob[end] == '/') span.remove_suffix(1);
+                captures.push(span);
+            };
+
+            // walk the glob tokens in order
+            for (size_t index = 0; index < glob.size(); ++index) {
+                switch (glob[index]) {
+                    case Action::WILD_ESCAPE: index += 1; break;
+                    case Action::WILD_QUERY: capture(index, index + 1, false); break;
+                    case Action::WILD_STAR: {
+                        auto globstar = glob.substr(index).starts_with("**");
+                        capture(index, index + 1 + globstar, globstar), index += globstar;
+                    } break;
+
+                    case Action::BRACK_OPEN: {
+                        auto closing = m_closing(glob, index);
+                        if (closing == glob.npos) break;  // a literal bracket
+                        capture(index, closing + 1, false), index = closing;
+                    } break;
+
+                    case Action::BRACE_OPEN: {
+                        capture(index, m_group(glob, index) + 1, false);
+                        braces.emplace_back(index, index + 1);
+                    } break;
+
+                    case Action::BRACE_COMMA: if (braces.size()) braces.back().second = index + 1; break;
+                    case Action::BRACE_CLOSE: if (braces.size()) braces.pop_back(); break;
+                    default: break;
+                }
+            }
+        }
+
+        /**
+         * @brief Finds the closing of a bracket expression.
+         * @param glob              Glob to search.
+         * @param index             Opening bracket index.
+         */
+        static inline constexpr size_t m_closing(std::string_view glob, size_t index) noexcept {
+            index += 1 + (index + 1 < glob.size() && (glob[index + 1] == '!' || glob[index + 1] == '^'));
+            for (bool first = true; index < glob.size(); ++index, first = false) {
+                if (glob[index] == '\\') index += 1;
+                else if (glob[index] == ']' && !first) return index;
+            }
+
+            // unclosed brackets are literals
+            return glob.npos;
+        }
+
+        /**
+         * @brief Finds the closing of a brace group.
+         * @param glob              Glob to search.
+         * @param index             Opening brace index.
+         */
+        static inline constexpr size_t m_group(std::string_view glob, size_t index) noexcept {
+            for (size_t depth = 0; index < glob.size(); ++index) {
+                switch (glob[index]) {
+                    case Action::WILD_ESCAPE: index += 1; break;
+                    case Action::BRACK_OPEN: index = std::min(m_closing(glob, index), glob.size() - 1); break;
+                    case Action::BRACE_OPEN: depth += 1; break;
+                    case Action::BRACE_CLOSE: if ((depth -= 1) == 0) return index; break;
+                    default: break;
+                }
+            }
+
+            // unclosed braces run to the end
+            return glob.size() - 1;
+        }
+
         /**
          * @brief Gets the expected negation of a bracket.
          * @param slice             Bracket slice.
@@ -172,6 +648,9 @@ namespace Aster {
             const std::string_view& glob, const std::string_view& input, uint32_t start) {
             // attempt iterating whilst we still have input/glob to process
             for (bool pending = false; (pending = m_state.glob < glob.size()) || m_state.path < input.size();) {
+                // record where each glob index is consumed (unless resuming a wildcard)
+                if (m_marks && pending && !std::exchange(m_resumed, false)) m_marks[m_state.glob] = m_state.path;
+
                 // get the incoming mode to be handled now
                 auto mode = pending ? m_process_pattern(glob, input, start) : Mode::WILD;
 
@@ -181,6 +660,10 @@ namespace Aster {
                     case Mode::WILD: {
                         if (!m_asterisk.path || m_asterisk.path > input.size()) return false;
                         m_state = m_asterisk;  // we can safely reset the state with the wildcard
+
+                        // later marks are stale now
+                        if (m_marks) std::fill(m_marks + m_state.glob + 1, m_marks + glob.size(), s_unset);
+                        m_resumed = m_marks != nullptr;
                     } break;
 
                     // immediate match so we can safely break
@@ -214,7 +697,17 @@ namespace Aster {
             cloned.m_state.glob = braces.index;
             cloned.m_state.braces = m_pending->size();
 
+            // failed alternatives must not disturb the marks (which follow the choices)
+            std::array<uint32_t, 256> inlined;
+            std::vector<uint32_t> spilled = {};
+            auto marks = std::span<uint32_t>(m_marks, m_marks ? glob.size() * 2 : 0);
+            auto saved = marks.size() <= inlined.size() ? std::span(inlined).first(marks.size())
+                                                        : (spilled.resize(marks.size()), std::span(spilled));
+            std::ranges::copy(marks, saved.begin());
+
             auto result = cloned.m_matches_pattern(glob, input, braces.index);
+            if (!result) std::ranges::copy(saved, marks.begin());
+            else if (m_choices) m_choices[braces.opened] = braces.index;  // the taken alternative
             return m_pending->pop_back(), result;  // and resolve now as needed
         }
 
@@ -428,7 +921,8 @@ namespace Aster {
             // handle any incoming globstars now
             if (globstar) {
                 auto invalid = m_state.glob != glob.size();  // check if invalid ending
-                auto separator = m_state.glob - start < 3 || glob[m_state.glob - 3] == '/';
+                auto leading = m_state.glob == start + 2 || m_state.glob < 3;  // may resume from before the braces
+                auto separator = leading || glob[m_state.glob - 3] == '/';
                 separator = separator && (!invalid || glob[m_state.glob] == '/');
                 if (separator) m_state.glob += invalid, m_skip_to_separator(input, invalid), recursive = true;
             }
@@ -444,7 +938,7 @@ namespace Aster {
         template <>
         inline constexpr Mode m_process_action<Action::WILD_QUERY>(
             const std::string_view&, const std::string_view& input, uint32_t) {
-            if (Detail::separator(input[m_state.path])) return Mode::WILD;
+            if (m_state.path >= input.size() || Detail::separator(input[m_state.path])) return Mode::WILD;
             return m_state.glob += 1, m_state.path += 1, Mode::OKAY;
         }
 
@@ -0,0 +1,121 @@
+#ifndef _ASTER_MEMORY_HPP
+#define _ASTER_MEMORY_HPP
+
+/// C++ Includes
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+
+/// Aster Includes
+#include "aster/backend.hpp"
+
+namespace Aster {
+
+    /// @brief In-Memory Tree Backend (copies share the same tree).
+    class Memory {
+        //  TYPEDEFS  //
+
+        /// @brief Directory listings keyed by directory path.
+        using Tree = std::unordered_map<std::string, std::vector<Entry>>;
+
+        /// @brief Listing positions of each entry keyed by path hash (paths themselves are not duplicated).
+        using Positions = std::unordered_multimap<size_t, size_t>;
+
+        //  PROPERTIES  //
+
+        /// @brief The root directory path.
+        std::string m_root = {};
+
+        /// @brief Shared directory listings.
+        std::shared_ptr<Tree> m_tree = std::make_shared<Tree>();
+
+        /// @brief Shared listing positions.
+        std::shared_ptr<Positions> m_positions = std::make_shared<Positions>();
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /// @brief Constructs an empty tree.
+        constexpr Memory() : Memory(Detail::getcwd()) {}
+
+        /**
+         * @brief Constructs a tree of files.
+         * @param root                  Root directory (walks set `Options::cwd` to it).
+         * @param files                 File paths relative to the root.
+         */
+        constexpr Memory(const std::string& root, std::initializer_list<std::string_view> files = {}) : m_root(root) {
+            (*m_tree)[m_root];  // the root always exists
+            for (const auto& file : files) add(file);
+        }
+
+        //  PUBLIC METHODS  //
+
+        /// @brief Gets the root directory path.
+        inline constexpr const std::string& root() const noexcept { return m_root; }
+
+        /**
+         * @brief Adds an entry (along with any missing parent directories).
+         * @param path                  Path relative to the root.
+         * @param type                  Entry type.
+         * @note Repeated paths keep their last type, and entries gaining children become directories.
+         */
+        inline constexpr void add(std::string_view path, Archetype type = Archetype::REGULAR) {
+            auto directory = m_root;
+            while (path.size()) {
+                auto ending = std::min(path.find_first_of(Detail::separator()), path.size());
+                auto name = path.substr(0, ending);
+                path.remove_prefix(std::min(ending + 1, path.size()));
+
+                // skip any empty (or current directory) segments
+                if (name.empty() || name == ".") continue;
+
+                // intermediate segments are directories
+                auto kind = path.size() ? Archetype::DIRECTORY : type;
+                auto child = Detail::join(directory, std::string(name));
+                m_insert(directory, Entry(child, kind));
+                directory = std::move(child);
+            }
+        }
+
+        /**
+         * @brief Opens a directory traversal over its buffered listing (unknown directories are empty).
+         * @param path                  Directory path.
+         * @param sorting               Listing sort order.
+         */
+        inline constexpr std::shared_ptr<Detail::Traversal> open(const std::string& path, Sorting sorting, bool) const {
+            auto found = m_tree->find(path);
+            if (found == m_tree->end()) return std::make_shared<Detail::Traversal>(path, Detail::Listing(), sorting);
+
+            // serve the listing in place (sharing ownership of the whole tree)
+            auto shared = std::shared_ptr<const std::vector<Entry>>(m_tree, &found->second);
+            return std::make_shared<Detail::Traversal>(path, Detail::Listing(std::move(shared)), sorting);
+        }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /**
+         * @brief Handles inserting an entry into its parent directory (replacing any entry of the same path).
+         * @param directory             Parent directory path.
+         * @param entry                 Entry to insert.
+         */
+        inline constexpr void m_insert(const std::string& directory, Entry&& entry) {
+            auto& listing = (*m_tree)[directory];
+            auto hash = std::hash<std::string_view>()(entry.path);
+            if (entry.type == Archetype::DIRECTORY) (*m_tree)[entry.path];
+
+            // replace the existing entry (so directories are never listed twice)
+            for (auto [position, ending] = m_positions->equal_range(hash); position != ending; ++position) {
+                auto index = position->second;  // colliding hashes may come from other directories
+                if (index < listing.size() && listing[index].path == entry.path) return void(listing[index] = entry);
+            }
+
+            // or append it as a new entry
+            m_positions->emplace(hash, listing.size());
+            listing.emplace_back(std::move(entry));
+        }
+    };
+
+}  // namespace Aster
+
+#endif
@@ -0,0 +1,317 @@
+#ifndef _ASTER_OPTIMIZER_HPP
+#define _ASTER_OPTIMIZER_HPP
+
+/// C++ Includes
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+/// Aster Includes
+#include "aster/pattern.hpp"
+
+namespace Aster {
+
+    /// @brief Pattern Redundancy Reasons.
+    enum class Redundancy : uint8_t {
+        DUPLICATE,  // a later identical pattern decides every path instead
+        SHADOWED,   // a later pattern matches every path it does (so it never decides any)
+        SUBSUMED,   // an earlier pattern of the same polarity already decides every path it does
+        INERT,      // a negation excluding nothing (no earlier pattern can include its paths)
+    };
+
+    /// @brief Removed Pattern Details.
+    struct Removal {
+        size_t index = 0;                           // Index of the removed pattern (within the original list).
+        size_t cause = SIZE_MAX;                    // Index of the pattern making it redundant (none when inert).
+        Redundancy reason = Redundancy::DUPLICATE;  // Why the pattern was redundant.
+    };
+
+    /// @brief Optimized Pattern List.
+    struct Optimized {
+        std::vector<Pattern> patterns = {};  // Remaining patterns (in their original order).
+        std::vector<size_t> kept = {};       // Original index of each remaining pattern.
+        std::vector<Removal> removed = {};   // Removed patterns (in the order they were found redundant).
+    };
+
+    /**
+     * @brief Ordered Pattern List Optimizer.
+     * @note Lists are read as ordered rules, where the last pattern matching a path decides it (negations exclude,
+     *       as in ignore files); for lists without negations this is the same as matching any pattern.
+     */
+    class Optimizer {
+       public:
+        //  PUBLIC METHODS  //
+
+        /**
+         * @brief Removes duplicate and provably redundant patterns (the result selects exactly the same paths).
+         * @param patterns              Ordered patterns.
+         * @note Redundancy is only reported when provable from the slices, so unusual globs (such as braces
+         *       spanning separators) are only ever removed as exact duplicates.
+         */
+        static inline Optimized optimize(std::span<const Pattern> patterns) {
+            // relations between patterns never change as others are removed, so are found once upfront
+            auto size = patterns.size();
+            auto covers = std::vector<uint8_t>(size * size), disjoint = std::vector<uint8_t>(size * size);
+            for (size_t outer = 0; outer < size; ++outer) {
+                for (size_t inner = 0; inner < size; ++inner) {
+                    if (outer == inner) continue;
+                    covers[outer * size + inner] = subsumes(patterns[outer], patterns[inner]);
+                    disjoint[outer * size + inner] = Optimizer::disjoint(patterns[outer], patterns[inner]);
+                }
+            }
+
+            // remove one redundant pattern at a time (since each removal may expose others)
+            auto result = Optimized();
+            for (size_t index = 0; index < size; ++index) result.kept.push_back(index);
+            while (auto removal = m_redundant(patterns, result.kept, covers, disjoint)) {
+                std::erase(result.kept, removal->index), result.removed.push_back(*removal);
+            }
+
+            // and collect the remaining patterns
+            for (auto index : result.kept) result.patterns.push_back(patterns[index]);
+            return result;
+        }
+
+        /**
+         * @brief Checks if an ordered pattern list selects a path (the last pattern matching it decides).
+         * @param patterns              Ordered patterns.
+         * @param input                 Input path.
+         */
+        static inline constexpr bool selects(std::span<const Pattern> patterns, std::string_view input) noexcept {
+            auto selected = false;
+            for (const auto& pattern : patterns) {
+                if (pattern.matches(input) != pattern.negated()) selected = !pattern.negated();
+            }
+
+            // resolve the deciding state
+            return selected;
+        }
+
+        /**
+         * @brief Checks if a pattern provably matches every path another does (ignoring their negations).
+         * @param general               Covering pattern.
+         * @param specific              Covered pattern.
+         * @note Hidden segments named by the covered pattern must also be named by the covering one, so walks
+         *       without `Options::hidden` stay equivalent.
+         */
+        static inline constexpr bool subsumes(const Pattern& general, const Pattern& specific) noexcept {
+            if (general.view() == specific.view()) return true;
+            if (general.absolute() != specific.absolute() || !m_balanced(general) || !m_balanced(specific)) {
+                return false;
+            }
+
+            // hidden segments must stay visible (and globstar-only patterns match any input)
+            if (!m_named(general, specific)) return false;
+            if (general.globstar() || specific.globstar()) return general.globstar();
+
+            // walk both slice sequences (memoizing each visited pair)
+            auto outer = general.slices(), inner = specific.slices();
+            auto visited = std::vector<int8_t>((outer.size() + 1) * (inner.size() + 1), -1);
+            return m_covers(outer, inner, 0, 0, visited);
+        }
+
+        /**
+         * @brief Checks if two patterns provably match no common path (ignoring their negations).
+         * @param first                 First pattern.
+         * @param second                Second pattern.
+         */
+        static inline constexpr bool disjoint(const Pattern& first, const Pattern& second) noexcept {
+            if (first.globstar() || second.globstar() || !m_balanced(first) || !m_balanced(second)) return false;
+            auto left = first.slices(), right = second.slices();
+
+            // globstar-free patterns only match paths with as many segments as slices
+            auto fixed = [](const Slice& slice) { return slice.hint() != Hint::GLOBSTAR; };
+            auto bounded = std::ranges::all_of(left, fixed) && std::ranges::all_of(right, fixed);
+            if (bounded && left.size() != right.size()) return true;
+
+            // otherwise compare the leading (and trailing) segments up to the first globstar
+            for (size_t index = 0; index < std::min(left.size(), right.size()); ++index) {
+                if (!fixed(left[index]) || !fixed(right[index])) break;
+                if (m_apart(left[index], right[index])) return true;
+            }
+
+            for (size_t index = 1; index <= std::min(left.size(), right.size()); ++index) {
+                auto& last = left[left.size() - index];
+                auto& other = right[right.size() - index];
+                if (!fixed(last) || !fixed(other)) break;
+                if (m_apart(last, other)) return true;
+            }
+
+            // no difference could be proven
+            return false;
+        }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /**
+         * @brief Finds the first redundant pattern remaining.
+         * @param patterns              Original patterns.
+         * @param kept                  Original indices of the remaining patterns.
+         * @param covers                Subsumption between original patterns (row covers column).
+         * @param disjoint              Disjointness between original patterns.
+         */
+        static inline std::optional<Removal> m_redundant(std::span<const Pattern> patterns,
+                                                         const std::vector<size_t>& kept,
+                                                         const std::vector<uint8_t>& covers,
+                                                         const std::vector<uint8_t>& disjoint) {
+            auto size = patterns.size();
+            auto covering = [&](size_t general, size_t specific) { return covers[general * size + specific] != 0; };
+            auto apart = [&](size_t first, size_t second) { return disjoint[first * size + second] != 0; };
+
+            for (size_t position = 0; position < kept.size(); ++position) {
+                auto index = kept[position];
+                auto& pattern = patterns[index];
+
+                // a later pattern covering it always decides instead
+                for (size_t later = position + 1; later < kept.size(); ++later) {
+                    if (!covering(kept[later], index)) continue;
+                    auto& other = patterns[kept[later]];
+                    auto same = other.negated() == pattern.negated() && other.view() == pattern.view();
+                    return Removal{ index, kept[later], same ? Redundancy::DUPLICATE : Redundancy::SHADOWED };
+                }
+
+                // an earlier pattern of the same polarity covering it already decides the same way (unless a
+                // pattern of the opposite polarity in between could have changed the decision)
+                auto opposing = [&](size_t begin) {
+                    return std::ranges::any_of(kept.begin() + begin, kept.begin() + position, [&](size_t other) {
+                        return patterns[other].negated() != pattern.negated() && !apart(other, index);
+                    });
+                };
+
+                for (size_t earlier = position; earlier-- > 0;) {
+                    auto& other = patterns[kept[earlier]];
+                    if (other.negated() != pattern.negated() || !covering(kept[earlier], index)) continue;
+                    if (!opposing(earlier + 1)) return Removal{ index, kept[earlier], Redundancy::SUBSUMED };
+                }
+
+                // and negations excluding nothing included before them are inert
+                if (pattern.negated() && !opposing(0)) return Removal{ index, SIZE_MAX, Redundancy::INERT };
+            }
+
+            // nothing is redundant now
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Checks if slices cover others from the given positions.
+         * @param outer                 Covering slices.
+         * @param inner                 Covered slices.
+         * @param first                 Position within the covering slices.
+         * @param second                Position within the covered slices.
+         * @param visited               Memoized results (-1 when unvisited).
+         */
+        static inline constexpr bool m_covers(std::span<const Slice> outer, std::span<const Slice> inner,
+                                              size_t first, size_t second, std::vector<int8_t>& visited) noexcept {
+            auto& result = visited[first * (inner.size() + 1) + second];
+            if (result >= 0) return result;
+
+            // globstars match any number of segments (at least one when trailing)
+            auto remaining = second < inner.size();
+            if (first == outer.size()) result = !remaining;
+            else if (outer[first].hint() == Hint::GLOBSTAR) {
+                if (first + 1 == outer.size()) result = remaining;
+                else result = m_covers(outer, inner, first + 1, second, visited) ||
+                              (remaining && m_covers(outer, inner, first, second + 1, visited));
+            } else {
+                // otherwise each segment must be covered in turn
+                result = remaining && inner[second].hint() != Hint::GLOBSTAR && m_admits(outer[first], inner[second]) &&
+                         m_covers(outer, inner, first + 1, second + 1, visited);
+            }
+
+            // resolve the memoized result
+            return result;
+        }
+
+        /**
+         * @brief Checks if a slice matches every segment another (single-segment) slice does.
+         * @param general               Covering slice.
+         * @param specific              Covered slice.
+         */
+        static inline constexpr bool m_admits(const Slice& general, const Slice& specific) noexcept {
+            if (general.hint() == specific.hint() && general.view() == specific.view()) return true;
+
+            // wildcards match any segment, and extensions any longer extension
+            auto view = specific.view();
+            switch (general.hint()) {
+                case Hint::WILDCARD: return true;
+                case Hint::EXTENDS: {
+                    if (specific.hint() == Hint::EXTENDS) return m_extends(view, general.view());
+                    break;
+                }
+
+                case Hint::SPECIAL: {
+                    if (general.view().starts_with('!')) return false;
+                    break;
+                }
+
+                default: return false;
+            }
+
+            // and otherwise only unescaped literals can be tested directly
+            auto literal = specific.hint() == Hint::LITERAL && view.find('\\') == view.npos;
+            return literal && Pattern::admits(general, view);
+        }
+
+        /**
+         * @brief Checks if two single-segment slices provably match no common segment.
+         * @param first                 First slice.
+         * @param second                Second slice.
+         */
+        static inline constexpr bool m_apart(const Slice& first, const Slice& second) noexcept {
+            auto literal = [](const Slice& slice) {
+                return slice.hint() == Hint::LITERAL && slice.view().find('\\') == slice.view().npos;
+            };
+
+            // order the pair so that any literal comes first
+            if (literal(second) && !literal(first)) return m_apart(second, first);
+            if (first.hint() == Hint::EXTENDS && second.hint() == Hint::EXTENDS) {
+                return !m_extends(first.view(), second.view()) && !m_extends(second.view(), first.view());
+            }
+
+            // literals can be tested directly against anything but negated segments
+            if (!literal(first) || second.hint() == Hint::WILDCARD || second.view().starts_with('!')) return false;
+            return !Pattern::admits(second, first.view());
+        }
+
+        /**
+         * @brief Checks if every name with an extension also has a shorter extension ("tar.gz" and "gz").
+         * @param extension             Longer extension.
+         * @param suffix                Shorter extension.
+         */
+        static inline constexpr bool m_extends(std::string_view extension, std::string_view suffix) noexcept {
+            if (extension == suffix) return true;
+            auto size = extension.size() - suffix.size();
+            return extension.size() > suffix.size() && extension.ends_with(suffix) && extension[size - 1] == '.';
+        }
+
+        /**
+         * @brief Checks if every hidden segment one pattern names is also named by another.
+         * @param general               Covering pattern.
+         * @param specific              Covered pattern.
+         */
+        static inline constexpr bool m_named(const Pattern& general, const Pattern& specific) noexcept {
+            return std::ranges::all_of(specific.slices(), [&](const Slice& slice) {
+                if (!slice.view().starts_with('.')) return true;
+                return std::ranges::any_of(general.slices(), [&](const Slice& other) {
+                    return other.view().starts_with('.') && m_admits(other, slice);
+                });
+            });
+        }
+
+        /**
+         * @brief Checks that no slice has braces spanning separators (so each slice is a single segment).
+         * @param pattern               Pattern to check.
+         */
+        static inline constexpr bool m_balanced(const Pattern& pattern) noexcept {
+            return std::ranges::all_of(pattern.slices(), [](const Slice& slice) {
+                return std::ranges::count(slice.view(), '{') == std::ranges::count(slice.view(), '}');
+            });
+        }
+    };
+
+}  // namespace Aster
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef _ASTER_OPTIONS_HPP
+#define _ASTER_OPTIONS_HPP
+
+/// C++ Includes
+#include <functional>
+#include <system_error>
+
+/// Aster Includes
+#include "aster/entry.hpp"
+
+namespace Aster {
+
+    /// @brief Forward Declarations.
+    class Budget;
+    class Snapshot;
+    struct Statistics;
+    struct Trace;
+
+    /// @brief Directory Traversal Orders.
+    enum class Order : uint8_t {
+        DEPTH,     // depth-first (least memory)
+        BREADTH,   // breadth-first (shallow matches first)
+        PRIORITY,  // best-first (highest `Options::priority` first)
+    };
+
+    /// @brief Directory Failure Recoveries.
+    enum class Recovery : uint8_t {
+        SKIP,   // treat the directory as empty
+        RETRY,  // attempt opening the directory again
+        STOP,   // stop the walk immediately
+    };
+
+    /// @brief Traversal Options.
+    struct Options {
+        //  PROPERTIES  //
+
+        bool files = true;         // Allow matching files.
+        bool hidden = false;       // Allow matching hidden (and descending hidden directories).
+        bool symlinks = false;     // Allow matching symlinks.
+        bool directories = false;  // Allow matching directories.
+
+        /// @brief Per-directory sort order (sorted walks stream in lexicographic path order).
+        Sorting sorting = Sorting::NONE;
+
+        /// @brief Optional snapshot to reuse (and refresh) unchanged directory listings.
+        Snapshot* snapshot = nullptr;
+
+        /// @brief Order in which pending directories are opened.
+        Order order = Order::DEPTH;
+
+        /// @brief Directory priority (for `Order::PRIORITY`, higher opens first).
+        std::function<double(std::string_view)> priority = nullptr;
+
+        /// @brief Optional predicate pruning directories (checked before they are queued, whether or not they match).
+        std::function<bool(std::string_view)> prune = nullptr;
+
+        /// @brief Optional shared cap on simultaneously open directory handles.
+        Budget* budget = nullptr;
+
+        /// @brief Optional handler for directories that fail to open (skipped otherwise).
+        std::function<Recovery(const std::string&, std::error_code)> error = nullptr;
+
+        /// @brief Optional statistics to record into (requires `ASTER_STATISTICS_ENABLED`).
+        Statistics* statistics = nullptr;
+
+        /// @brief Optional callback fired as each directory is opened and closed (see `Aster::Chrome`).
+        std::function<void(const Trace&)> trace = nullptr;
+
+        /// @brief The current working directory.
+        std::string cwd = Detail::getcwd();
+    };
+
+}  // namespace Aster
+
+#endif
@@ -0,0 +1,298 @@
+#ifndef _ASTER_PARALLEL_HPP
+#define _ASTER_PARALLEL_HPP
+
+/// C++ Includes
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+/// Aster Includes
+#include "aster/channel.hpp"
+#include "aster/iterator.hpp"
+
+namespace Aster::Detail {
+
+    /**
+     * @brief Parallel Walk Consumer (every worker both walks directories and consumes matched entries).
+     * @tparam Source               Traversal backend.
+     * @tparam Consumer             Callback taking a `const Entry&` and returning a `Visit` action (or void).
+     * @note Matches are handed over in batches through a lock-free ring, and workers only list directories (their
+     *       own newest first, otherwise stealing another workers oldest) once the ring runs dry.
+     */
+    template <Backend Source, typename Consumer>
+    class Parallel {
+        //  TYPEDEFS  //
+
+        /// @brief Matched entries handed over at once.
+        using Batch = std::vector<Entry>;
+
+        /// @brief Pending directories of a worker (padded against false sharing).
+        struct alignas(64) Queue {
+            std::mutex mutex = {};
+            std::deque<std::string> directories = {};
+        };
+
+        //  PROPERTIES  //
+
+        /// @brief Matches per batch.
+        static constexpr size_t s_batch = 64;
+
+        /// @brief Walk options.
+        const Options& m_options;
+
+        /// @brief Traversal backend.
+        Source m_backend = {};
+
+        /// @brief Entry filter.
+        Filter m_filter = {};
+
+        /// @brief Match consumer.
+        Consumer& m_consumer;
+
+        /// @brief Batches awaiting a consumer.
+        Channel<Batch> m_channel;
+
+        /// @brief Pending directories of each worker.
+        std::unique_ptr<Queue[]> m_queues = nullptr;
+
+        /// @brief Number of workers.
+        size_t m_count = 1;
+
+        /// @brief Directories and batches not yet finished with (the walk completes at zero).
+        alignas(64) std::atomic<size_t> m_outstanding = 0;
+
+        /// @brief Directories queued across every worker.
+        alignas(64) std::atomic<size_t> m_queued = 0;
+
+        /// @brief Wake-up counter (idle workers wait for it to change).
+        alignas(64) std::atomic<uint32_t> m_signal = 0;
+
+        /// @brief Number of idle workers.
+        std::atomic<uint32_t> m_idle = 0;
+
+        /// @brief Denotes if the walk was stopped.
+        std::atomic<bool> m_stopped = false;
+
+        /// @brief First failure thrown by the consumer.
+        std::exception_ptr m_exception = nullptr;
+
+        /// @brief Guards the failure.
+        std::mutex m_mutex = {};
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /**
+         * @brief Prepares a parallel walk.
+         * @param patterns              Glob patterns (at most `Detail::capacity()`).
+         * @param options               Walk options.
+         * @param consumer              Match consumer (called concurrently).
+         * @param threads               Worker threads (the hardware concurrency when zero).
+         * @param backend               Traversal backend.
+         */
+        Parallel(std::span<const Pattern> patterns, const Options& options, Consumer& consumer, size_t threads,
+                 const Source& backend) :
+            m_options(options), m_backend(backend), m_filter(patterns, options), m_consumer(consumer),
+            m_channel(std::max<size_t>(threads ? threads : std::thread::hardware_concurrency(), 1) * 16),
+            m_count(std::max<size_t>(threads ? threads : std::thread::hardware_concurrency(), 1)) {
+            m_queues = std::make_unique<Queue[]>(m_count);
+        }
+
+        Parallel(const Parallel&) = delete;
+
+        //  PUBLIC METHODS  //
+
+        /**
+         * @brief Runs the walk on every worker (including the calling thread).
+         * @returns False if the walk was stopped early.
+         */
+        inline bool run() {
+            m_push(0, m_options.cwd);
+            {
+                auto workers = std::vector<std::jthread>();
+                for (size_t index = 1; index < m_count; ++index) workers.emplace_back([this, index] { m_work(index); });
+                m_work(0);
+            }
+
+            // rethrow any consumer failure once every worker has finished
+            if (m_exception) std::rethrow_exception(m_exception);
+            return !m_stopped;
+        }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /**
+         * @brief Handles a workers loop.
+         * @param index                 Worker index.
+         */
+        inline void m_work(size_t index) {
+            auto carry = Batch();  // matches not yet handed over
+            for (auto batch = Batch(); !m_stopped.load(std::memory_order_relaxed);) {
+                // consuming comes first, so the walk only runs ahead whilst consumers keep up
+                if (m_channel.pop(batch)) {
+                    m_consume(batch);
+                    continue;
+                }
+
+                // otherwise walk a directory, handing over any partial batch before idling
+                if (auto directory = m_take(index)) m_list(index, *directory, carry);
+                else if (carry.size()) m_publish(carry);
+                else if (m_outstanding.load() == 0) break;
+                else m_wait();
+            }
+        }
+
+        /**
+         * @brief Handles listing a directory (queueing its sub-directories and batching its matches).
+         * @param index                 Worker index.
+         * @param directory             Directory path.
+         * @param carry                 Workers partial batch.
+         */
+        inline void m_list(size_t index, const std::string& directory, Batch& carry) {
+            auto traversal = m_open(directory);
+            while (traversal && !traversal->done() && !m_stopped.load(std::memory_order_relaxed)) {
+                const auto& entry = traversal->advance();
+                if (entry.path.empty()) continue;  // skipped entries (such as "." and "..")
+
+                // sub-directories are queued locally (others steal them when idle)
+                if (entry.type == Archetype::DIRECTORY && m_filter.descends(entry.path)) m_push(index, entry.path);
+                auto mask = m_filter.test(entry);
+                if (mask == 0) continue;
+
+                // each batch is outstanding from its first match until consumed
+                if (carry.empty()) carry.reserve(s_batch), m_outstanding.fetch_add(1);
+                carry.emplace_back(entry).mask = mask;
+                if (carry.size() >= s_batch) m_publish(carry);
+            }
+
+            // the directory itself is now finished with
+            m_settle();
+        }
+
+        /**
+         * @brief Handles opening a directory (recovering failures as `Options::error` decides).
+         * @param directory             Directory path.
+         */
+        inline std::shared_ptr<Traversal> m_open(const std::string& directory) {
+            for (;;) {
+                auto budget = m_options.budget;  // budgeted listings are read in full whilst holding a handle
+                auto lease = budget ? budget->acquire() : Budget::Lease();
+                auto traversal = std::shared_ptr<Traversal>(m_backend.open(directory, Sorting::NONE, budget));
+                if (!traversal->error() || !m_options.error) return traversal;
+
+                // otherwise let the handler decide how to recover
+                switch (m_options.error(directory, traversal->error())) {
+                    case Recovery::SKIP: return traversal;
+                    case Recovery::RETRY: continue;
+                    case Recovery::STOP: return m_stop(), nullptr;
+                }
+            }
+        }
+
+        /**
+         * @brief Handles handing a batch over to any consumer (consuming it directly when the ring is full).
+         * @param carry                 Batch to hand over (left empty).
+         */
+        inline void m_publish(Batch& carry) {
+            if (m_channel.push(carry)) return carry = Batch(), m_notify();
+            m_consume(carry), carry.clear();
+        }
+
+        /**
+         * @brief Handles consuming a batch.
+         * @param batch                 Batch to consume.
+         */
+        inline void m_consume(const Batch& batch) {
+            for (const auto& entry : batch) {
+                if (m_stopped.load(std::memory_order_relaxed)) break;
+                try {
+                    // void consumers always continue (and directories were already queued, so nothing is skipped)
+                    if constexpr (std::is_void_v<std::invoke_result_t<Consumer&, const Entry&>>) m_consumer(entry);
+                    else if (m_consumer(entry) == Visit::STOP) m_stop();
+                } catch (...) {
+                    auto lock = std::scoped_lock(m_mutex);
+                    if (!m_exception) m_exception = std::current_exception();
+                    m_stop();
+                }
+            }
+
+            // the batch is now finished with
+            m_settle();
+        }
+
+        /**
+         * @brief Handles queueing a directory.
+         * @param index                 Worker index.
+         * @param directory             Directory path.
+         */
+        inline void m_push(size_t index, const std::string& directory) {
+            m_outstanding.fetch_add(1);
+            {
+                auto lock = std::scoped_lock(m_queues[index].mutex);
+                m_queues[index].directories.push_back(directory);
+            }
+
+            // wake any idle worker to steal it
+            m_queued.fetch_add(1), m_notify();
+        }
+
+        /**
+         * @brief Takes a directory to list (the workers newest, otherwise the oldest of another).
+         * @param index                 Worker index.
+         */
+        inline std::optional<std::string> m_take(size_t index) {
+            if (m_queued.load() == 0) return std::nullopt;
+            for (size_t offset = 0; offset < m_count; ++offset) {
+                auto& queue = m_queues[(index + offset) % m_count];
+                auto lock = std::scoped_lock(queue.mutex);
+                if (queue.directories.empty()) continue;
+
+                // owners work depth-first, whereas thieves take the shallowest (largest) directories
+                auto directory = std::move(offset ? queue.directories.front() : queue.directories.back());
+                offset ? queue.directories.pop_front() : queue.directories.pop_back();
+                return m_queued.fetch_sub(1), std::move(directory);
+            }
+
+            // nothing was available
+            return std::nullopt;
+        }
+
+        /// @brief Handles finishing a directory or batch (waking every worker once the walk completes).
+        inline void m_settle() {
+            if (m_outstanding.fetch_sub(1) == 1) m_wake();
+        }
+
+        /// @brief Handles stopping the walk.
+        inline void m_stop() { m_stopped.store(true), m_wake(); }
+
+        /// @brief Handles waiting for work (or completion) whilst idle.
+        inline void m_wait() {
+            m_idle.fetch_add(1);
+            auto signal = m_signal.load();
+
+            // check again before sleeping (anything published since changes the signal)
+            auto ready = m_stopped.load() || m_outstanding.load() == 0 || m_queued.load() || !m_channel.empty();
+            if (!ready) m_signal.wait(signal);
+            m_idle.fetch_sub(1);
+        }
+
+        /// @brief Handles signalling published work (waking any idle workers).
+        inline void m_notify() {
+            m_signal.fetch_add(1);
+            if (m_idle.load()) m_signal.notify_all();
+        }
+
+        /// @brief Handles waking every idle worker.
+        inline void m_wake() { m_signal.fetch_add(1), m_signal.notify_all(); }
+    };
+
+}  // namespace Aster::Detail
+
+#endif
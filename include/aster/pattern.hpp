@@ -1,7 +1,12 @@
 #ifndef _ASTER_PATTERN_HPP
 #define _ASTER_PATTERN_HPP
 
+/// C++ Includes
+#include <algorithm>
+#include <cstdint>
+
 /// Aster Includes
+#include "aster/cache.hpp"
 #include "aster/compile.hpp"
 
 namespace Aster {
@@ -25,10 +30,58 @@ namespace Aster {
          */
         constexpr Pattern(const char* glob) : Pattern(std::string(glob)) {}
         constexpr Pattern(const std::string_view& glob) : Pattern(std::string(glob)) {}
-        constexpr Pattern(const std::string& glob) : m_encoded(Detail::Compile().pattern(glob)) {}
+        constexpr Pattern(const std::string& glob) : m_encoded(Detail::Compile().pattern(glob)) { m_reslice(); }
+
+        /**
+         * @brief Constructs a compiled pattern with an explicit matching mode.
+         * @param glob              Glob to compile.
+         * @param matching          Matching mode (`Matching::LINEAR` bounds the cost of untrusted globs).
+         */
+        constexpr Pattern(const std::string& glob, Matching matching) :
+            m_encoded(Detail::Compile().pattern(glob, matching)) {
+            m_reslice();
+        }
+
+        /**
+         * @brief Copies (or moves) a compiled pattern, re-binding its slices to the new buffer.
+         * @param other             Pattern to copy.
+         */
+        constexpr Pattern(const Pattern& other) : m_encoded(other.m_encoded) { m_reslice(); }
+        constexpr Pattern(Pattern&& other) noexcept : m_encoded(std::move(other.m_encoded)) { m_reslice(); }
+
+        //  OPERATOR METHODS  //
+
+        /**
+         * @brief Assigns a compiled pattern, re-binding its slices to the new buffer.
+         * @param other             Pattern to assign.
+         */
+        inline constexpr Pattern& operator=(const Pattern& other) {
+            if (this != &other) m_encoded = other.m_encoded, m_reslice();
+            return *this;
+        }
+
+        inline constexpr Pattern& operator=(Pattern&& other) noexcept {
+            if (this != &other) m_encoded = std::move(other.m_encoded), m_reslice();
+            return *this;
+        }
 
         //  PUBLIC METHODS  //
 
+        /**
+         * @brief Gets a shared compiled pattern (compiling it only if not recently used).
+         * @param glob              Glob to compile.
+         * @note Suits string-based callers that would otherwise recompile the same globs (see `cache()`).
+         */
+        static inline std::shared_ptr<const Pattern> cached(std::string_view glob) {
+            return cache().get(glob, [](std::string_view text) { return Pattern(text); });
+        }
+
+        /// @brief Gets the process-wide cache used by `cached()` (for its counters).
+        static inline Cache<Pattern>& cache() {
+            static auto s_cache = Cache<Pattern>(4096);
+            return s_cache;
+        }
+
         /// @brief Denotes if the associated pattern is empty.
         inline constexpr bool empty() const noexcept { return m_buffer().empty(); }
 
@@ -47,9 +100,83 @@ namespace Aster {
         /// @brief Gets the glob pattern encapsulated.
         inline constexpr std::string_view view() const noexcept { return m_buffer(); }
 
+        /**
+         * @brief Estimates the worst-case matching steps per input character.
+         * @note The backtracking matcher retries the rest of the glob for every brace alternative, so nested and
+         *       sequential braces multiply; the linear matcher (and literal or extension fast paths) never do.
+         */
+        inline constexpr size_t complexity() const noexcept {
+            if (m_algorithm() == Match::linear) return m_buffer().size() + 1;
+            if (m_algorithm() != Match::glob) return 1;  // fast paths scan the input once
+
+            // every brace alternative may retry the whole glob
+            auto size = m_buffer().size() + 1, alternatives = m_alternatives(m_buffer());
+            return alternatives > SIZE_MAX / size ? SIZE_MAX : size * alternatives;
+        }
+
         /// @brief Gets the component slices of the pattern.
         inline constexpr std::span<const Slice> slices() const noexcept { return m_slices(); }
 
+        /**
+         * @brief Checks if entries within a directory could match (conservatively).
+         * @param directory         Directory path (relative unless the pattern is absolute).
+         */
+        inline constexpr bool descends(std::string_view directory) const noexcept {
+            // negations (and trailing globstars) may match anything within
+            if (negated() || globstar()) return true;
+
+            // braces spanning separators cannot be followed per-segment
+            auto slices = m_slices();
+            if (std::ranges::any_of(slices, m_spanning)) return true;
+
+            // walk each directory segment against the slices
+            for (size_t index = 0;; ++index) {
+                auto ending = std::min(directory.find_first_of(Detail::separator()), directory.size());
+                auto segment = directory.substr(0, ending);
+
+                // a pattern with no slices remaining cannot match deeper
+                if (index >= slices.size()) return false;
+
+                // otherwise check the segment against the slice
+                switch (auto& slice = slices[index]; slice.hint()) {
+                    case Hint::GLOBSTAR: return true;
+                    case Hint::WILDCARD: break;
+                    default: if (!admits(slice, segment)) return false;
+                }
+
+                // stop once the directory has been consumed
+                if (ending == directory.size()) return index + 1 < slices.size();
+                directory.remove_prefix(ending + 1);
+            }
+        }
+
+        /**
+         * @brief Checks if a slice could match a single path segment (conservatively).
+         * @param slice             Slice to test.
+         * @param segment           Path segment.
+         */
+        static inline constexpr bool admits(const Slice& slice, std::string_view segment) noexcept {
+            auto view = slice.view();
+            if (m_spanning(slice)) return true;  // braces spanning separators cannot be tested per-segment
+
+            switch (slice.hint()) {
+                case Hint::EXTENDS: {
+                    auto dot = segment.size() - view.size() - 1;  // "*.ext" matches any name ending in ".ext"
+                    return segment.size() > view.size() && segment.ends_with(view) && segment[dot] == '.';
+                }
+
+                case Hint::LITERAL: {
+                    if (view.find('\\') == view.npos) return view == segment;
+                    return Match::glob(view, segment);  // handles any escapes
+                }
+
+                default: break;
+            }
+
+            // nor can leading negations
+            return view.starts_with('!') || Match::glob(view, segment);
+        }
+
         /**
          * @brief Handles matching against this pattern.
          * @param input             Input to validate.
@@ -58,9 +185,63 @@ namespace Aster {
             return m_flags().negated != m_algorithm()(m_buffer(), input);
         }
 
+        /**
+         * @brief Handles matching against this pattern, capturing the span of each wildcard.
+         * @param input             Input to validate (which the captures view).
+         * @note Captures follow glob order (`*`, `**`, `?`, brackets and braces), and are found with a single
+         *       backtracking pass (even for `Matching::LINEAR` patterns); negated patterns capture nothing.
+         */
+        inline constexpr Captures match_captures(const std::string_view& input) const {
+            auto captures = Captures();
+            auto matched = Match::captures(m_buffer(), input, captures);
+            if (m_flags().negated) captures.reset(!matched);
+            return captures;
+        }
+
        private:
         //  PRIVATE METHODS  //
 
+        /**
+         * @brief Checks if a slice was cut from braces spanning separators (its braces are unbalanced).
+         * @param slice             Slice to check.
+         */
+        static inline constexpr bool m_spanning(const Slice& slice) noexcept {
+            return std::ranges::count(slice.view(), '{') != std::ranges::count(slice.view(), '}');
+        }
+
+        /// @brief Re-binds the slices to the owned buffer (since slices are views).
+        inline constexpr void m_reslice() { std::get<1>(m_encoded) = Detail::Compile().slices(m_buffer()); }
+
+        /**
+         * @brief Counts the brace expansions of a glob (saturating).
+         * @param glob              Glob to count.
+         */
+        static inline constexpr size_t m_alternatives(std::string_view glob) noexcept {
+            auto multiply = [](size_t lhs, size_t rhs) { return rhs && lhs > SIZE_MAX / rhs ? SIZE_MAX : lhs * rhs; };
+
+            // each open brace tracks its enclosing product, its total so far and its current alternative
+            std::vector<std::pair<size_t, size_t>> stack = {};
+            size_t current = 1;
+            for (size_t index = 0, brackets = 0; index < glob.size(); ++index) {
+                switch (glob[index]) {
+                    case '\\': index += 1; break;
+                    case '[': brackets += 1; break;
+                    case ']': brackets -= brackets > 0; break;
+                    case '{': if (!brackets) stack.emplace_back(current, 0), current = 1; break;
+                    case ',': if (!brackets && stack.size()) stack.back().second += current, current = 1; break;
+                    case '}': {
+                        if (brackets || stack.empty()) break;
+                        auto [outer, total] = stack.back();
+                        stack.pop_back(), current = multiply(outer, std::min(total, SIZE_MAX - current) + current);
+                    } break;
+                    default: break;
+                }
+            }
+
+            // and resolve the total expansions
+            return current;
+        }
+
         inline constexpr std::string_view m_buffer() const noexcept { return std::get<0>(m_encoded); }
         inline constexpr const Detail::Flags& m_flags() const noexcept { return std::get<3>(m_encoded); }
         inline constexpr const std::vector<Slice>& m_slices() const noexcept { return std::get<1>(m_encoded); }
@@ -0,0 +1,218 @@
+#ifndef _ASTER_PENDING_HPP
+#define _ASTER_PENDING_HPP
+
+/// C++ Includes
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/// Aster Includes
+#include "aster/options.hpp"
+
+namespace Aster::Detail {
+
+    /// @brief Compact Pending Directory Queue (names in a shared arena, linked to their parents).
+    class Pending {
+        //  TYPEDEFS  //
+
+        /// @brief Directory priority callback.
+        using Priority = std::function<double(std::string_view)>;
+
+        //  PROPERTIES  //
+
+        /// @brief Directory names arena.
+        std::string m_names = {};
+
+        /// @brief Name offsets of each node (a name runs until the next nodes offset).
+        std::vector<size_t> m_offsets = {};
+
+        /// @brief Parents of each node (ancestors always precede their descendants).
+        std::vector<uint32_t> m_parents = {};
+
+        /// @brief Priorities of each node (for best-first orders).
+        std::vector<double> m_priorities = {};
+
+        /// @brief Nodes waiting to be opened (a stack, queue or heap depending on the order).
+        std::vector<uint32_t> m_queue = {};
+
+        /// @brief Front of the queue (for breadth-first orders).
+        size_t m_head = 0;
+
+        /// @brief Number of waiting nodes.
+        size_t m_size = 0;
+
+        /// @brief Node of the currently open directory.
+        uint32_t m_current = s_none;
+
+        /// @brief Most recently queued node (whilst still waiting).
+        uint32_t m_last = s_none;
+
+        /// @brief Order in which nodes are opened.
+        Order m_order = Order::DEPTH;
+
+        /// @brief Associated directory priority.
+        Priority m_priority = nullptr;
+
+        /// @brief Denotes an absent node.
+        static constexpr uint32_t s_none = uint32_t(-1);
+
+        /// @brief Denotes a discarded node (for best-first orders).
+        static constexpr uint32_t s_dropped = uint32_t(-2);
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /// @brief Constructs an empty queue.
+        constexpr Pending() = default;
+
+        /**
+         * @brief Constructs a queue with a single root directory.
+         * @param root                  Root directory path.
+         * @param order                 Order in which directories are opened.
+         * @param priority              Directory priority (for `Order::PRIORITY`).
+         */
+        explicit constexpr Pending(const std::string& root, Order order = Order::DEPTH, Priority priority = nullptr) :
+            m_order(priority || order != Order::PRIORITY ? order : Order::DEPTH), m_priority(std::move(priority)) {
+            push(root);
+        }
+
+        //  PUBLIC METHODS  //
+
+        /// @brief Denotes if no directories are waiting.
+        inline constexpr bool empty() const noexcept { return m_size == 0; }
+
+        /// @brief Gets the number of waiting directories.
+        inline constexpr size_t size() const noexcept { return m_size; }
+
+        /// @brief Gets the (approximate) heap footprint in bytes.
+        inline constexpr size_t bytes() const noexcept {
+            auto nodes = m_offsets.capacity() * sizeof(size_t) + m_parents.capacity() * sizeof(uint32_t);
+            auto ranks = m_priorities.capacity() * sizeof(double) + m_queue.capacity() * sizeof(uint32_t);
+            return m_names.capacity() + nodes + ranks;
+        }
+
+        /**
+         * @brief Queues a directory found within the open directory (only its name is stored).
+         * @param path                  Directory path (stored in full when no directory is open).
+         */
+        inline constexpr void push(std::string_view path) {
+            auto node = m_last = uint32_t(m_parents.size());
+            if (m_order == Order::PRIORITY) m_priorities.push_back(m_priority(path));
+            if (m_current != s_none) path.remove_prefix(path.find_last_of(Detail::separator()) + 1);
+
+            // store the name and queue the node now
+            m_offsets.push_back(m_names.size()), m_parents.push_back(m_current), m_names.append(path);
+            m_queue.push_back(node), m_size += 1;
+            if (m_order == Order::PRIORITY) std::ranges::push_heap(m_queue, std::less(), m_rank());
+        }
+
+        /// @brief Opens the next directory (by order), resolving its full path.
+        inline constexpr std::string pop() {
+            switch (m_order) {
+                case Order::DEPTH: m_current = m_queue.back(), m_queue.pop_back(); break;
+                case Order::BREADTH: m_current = m_queue[m_head++], m_compact(); break;
+                case Order::PRIORITY: {
+                    // skip over any nodes that were discarded
+                    do {
+                        std::ranges::pop_heap(m_queue, std::less(), m_rank());
+                        m_current = m_queue.back(), m_queue.pop_back();
+                    } while (m_parents[m_current] == s_dropped);
+                    break;
+                }
+            }
+
+            // the opened node is no longer waiting
+            if (m_size -= 1; m_current == m_last) m_last = s_none;
+            return m_truncate(), m_path(m_current);
+        }
+
+        /**
+         * @brief Checks if a path was the most recently queued directory (and is still waiting).
+         * @param path                  Directory path.
+         */
+        inline constexpr bool queued(std::string_view path) const { return m_last != s_none && m_path(m_last) == path; }
+
+        /// @brief Discards the most recently queued directory without opening it.
+        inline constexpr void drop() {
+            if (m_last == s_none) return;  // nothing left to discard
+
+            // best-first heaps discard lazily, otherwise the node is at the back
+            if (m_order == Order::PRIORITY) m_parents[m_last] = s_dropped;
+            else m_queue.pop_back();
+
+            // and release the node where possible
+            m_size -= 1, m_last = s_none, m_truncate();
+        }
+
+        /// @brief Closes the open directory, returning to its parent.
+        inline constexpr void close() {
+            if (m_current != s_none) m_current = m_parents[m_current], m_truncate();
+        }
+
+        /// @brief Clears all directories.
+        inline constexpr void clear() noexcept {
+            m_names.clear(), m_offsets.clear(), m_parents.clear(), m_priorities.clear(), m_queue.clear();
+            m_head = m_size = 0, m_current = m_last = s_none;
+        }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /// @brief Gets the node priority projection (for the heap ordering).
+        inline constexpr std::function<double(uint32_t)> m_rank() const {
+            return [this](uint32_t index) { return m_priorities[index]; };
+        }
+
+        /**
+         * @brief Gets a nodes name.
+         * @param index                 Node index.
+         */
+        inline constexpr std::string_view m_name(uint32_t index) const noexcept {
+            auto ending = index + 1 < m_offsets.size() ? m_offsets[index + 1] : m_names.size();
+            return std::string_view(m_names).substr(m_offsets[index], ending - m_offsets[index]);
+        }
+
+        /**
+         * @brief Rebuilds the full path of a node.
+         * @param index                 Node index.
+         */
+        inline constexpr std::string m_path(uint32_t index) const {
+            size_t size = 0;  // measure the chain upfront
+            for (auto node = index; node != s_none; node = m_parents[node]) size += m_name(node).size() + 1;
+
+            // and fill in each name from the back (between native separators)
+            auto path = std::string(size - 1, Detail::separator().back());
+            for (auto node = index; node != s_none; node = m_parents[node]) {
+                auto name = m_name(node);
+                size -= name.size() + 1, std::ranges::copy(name, path.begin() + size);
+            }
+
+            // resolve the resulting path
+            return path;
+        }
+
+        /// @brief Releases the consumed front of a breadth-first queue.
+        inline constexpr void m_compact() {
+            if (m_head * 2 < m_queue.size()) return;  // amortize the shifting
+            m_queue.erase(m_queue.begin(), m_queue.begin() + m_head), m_head = 0;
+        }
+
+        /// @brief Releases nodes that are neither waiting nor open (nor their ancestors).
+        inline constexpr void m_truncate() {
+            if (m_order != Order::DEPTH) return;  // other orders keep every discovered node
+
+            // depth-first nodes above the open and waiting ones are finished with
+            auto current = m_current == s_none ? 0 : m_current + 1;
+            auto keep = size_t(std::max(current, m_queue.empty() ? 0 : m_queue.back() + 1));
+            if (keep >= m_offsets.size()) return;  // nothing to release
+
+            // drop the trailing nodes along with their names
+            m_names.resize(m_offsets[keep]), m_offsets.resize(keep), m_parents.resize(keep);
+        }
+    };
+
+}  // namespace Aster::Detail
+
+#endif
@@ -0,0 +1,266 @@
+#ifndef _ASTER_SNAPSHOT_HPP
+#define _ASTER_SNAPSHOT_HPP
+
+/// C++ Includes
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <optional>
+#include <unordered_map>
+
+/// Aster Includes
+#include "aster/listing.hpp"
+
+#ifdef _ASTER_PLATFORM_UNIX
+/// OS Includes
+#include <sys/stat.h>
+#endif
+
+namespace Aster {
+
+    /// @brief Persisted Directory Snapshot.
+    class Snapshot {
+        //  TYPEDEFS  //
+
+        /// @brief Directory identity and modification stamp.
+        struct Stamp {
+            uint64_t device = 0;
+            uint64_t inode = 0;
+            int64_t modified = 0;  // mtime (nanoseconds)
+            int64_t changed = 0;   // ctime (nanoseconds)
+
+            constexpr bool operator==(const Stamp&) const = default;
+        };
+
+        /// @brief Cached directory listing.
+        struct Record {
+            Stamp stamp = {};
+            std::string names = {};             // NUL-terminated entry names
+            std::vector<Archetype> types = {};  // entry types (in name order)
+            bool visited = false;               // denotes if used since loading
+        };
+
+        //  PROPERTIES  //
+
+        /// @brief Cached records keyed by directory path.
+        std::unordered_map<std::string, Record> m_records = {};
+
+        /// @brief File signature (including the format version).
+        static constexpr std::string_view s_signature = "ASTERSN1";
+
+        /// @brief Upper bound on any serialized length (guards corrupt files).
+        static constexpr uint64_t s_limit = uint64_t(1) << 32;
+
+        /// @brief Directories modified within this window are not cached.
+        std::chrono::nanoseconds m_window = std::chrono::seconds(2);
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /// @brief Constructs an empty snapshot.
+        constexpr Snapshot() = default;
+
+        /**
+         * @brief Constructs a snapshot from a previously saved file.
+         * @param file                  File to load (ignored if invalid).
+         */
+        explicit constexpr Snapshot(const std::string& file) { load(file); }
+
+        //  PUBLIC METHODS  //
+
+        /// @brief Gets the number of cached directories.
+        inline constexpr size_t size() const noexcept { return m_records.size(); }
+
+        /**
+         * @brief Sets the window in which recently modified directories are not cached.
+         * @param window                Racy window (should cover the timestamp granularity).
+         */
+        inline constexpr void window(std::chrono::nanoseconds window) noexcept { m_window = window; }
+
+        /// @brief Clears all cached directories.
+        inline constexpr void clear() noexcept { m_records.clear(); }
+
+        /// @brief Drops any cached directories that were not visited since loading.
+        inline constexpr void prune() {
+            std::erase_if(m_records, [](const auto& pair) { return !pair.second.visited; });
+        }
+
+        /**
+         * @brief Gets a directories stamp (if supported).
+         * @param path                  Directory path.
+         */
+        static inline constexpr std::optional<Stamp> stamp(const std::string& path) noexcept {
+#ifdef _ASTER_PLATFORM_UNIX
+            struct ::stat status = {};
+            if (::stat(path.c_str(), &status) != 0 || !S_ISDIR(status.st_mode)) return std::nullopt;
+
+#ifdef __APPLE__
+            auto modified = status.st_mtimespec, changed = status.st_ctimespec;
+#else
+            auto modified = status.st_mtim, changed = status.st_ctim;
+#endif
+
+            // convert the details into our resulting stamp now
+            return Stamp {
+                .device = uint64_t(status.st_dev),
+                .inode = uint64_t(status.st_ino),
+                .modified = int64_t(modified.tv_sec) * 1'000'000'000 + modified.tv_nsec,
+                .changed = int64_t(changed.tv_sec) * 1'000'000'000 + changed.tv_nsec,
+            };
+#else
+            return std::nullopt;
+#endif
+        }
+
+        /**
+         * @brief Finds a cached listing that is still current.
+         * @param path                  Directory path.
+         * @param stamp                 Current directory stamp.
+         */
+        inline constexpr std::optional<Detail::Listing> find(const std::string& path, const Stamp& stamp) {
+            auto found = m_records.find(path);
+            if (found == m_records.end() || found->second.stamp != stamp) return std::nullopt;
+
+            // rebuild the listing from the cached names now
+            auto& record = found->second;
+            auto listing = Detail::Listing();
+
+            size_t offset = 0;  // walk the packed names
+            for (auto type : record.types) {
+                auto name = std::string_view(record.names).substr(offset);
+                name = name.substr(0, name.find('\0')), offset += name.size() + 1;
+                listing.push(Entry(Detail::join(path, std::string(name)), type));
+            }
+
+            // mark as visited and resolve the listing
+            return record.visited = true, listing;
+        }
+
+        /**
+         * @brief Records a fresh directory listing.
+         * @param path                  Directory path.
+         * @param stamp                 Directory stamp (taken before listing).
+         * @param listing               Full directory listing.
+         */
+        inline constexpr void record(const std::string& path, const Stamp& stamp, const Detail::Listing& listing) {
+            // directories modified within the timestamp granularity may change unnoticed
+            if (m_racy(stamp)) return void(m_records.erase(path));
+
+            // pack all the entry names now
+            auto record = Record { .stamp = stamp, .visited = true };
+            record.types.reserve(listing.size());
+
+            for (const auto& entry : listing.entries()) {
+                record.names.append(entry.path, path.size() + 1).push_back('\0');
+                record.types.emplace_back(entry.type);
+            }
+
+            // and store the resulting record
+            m_records.insert_or_assign(path, std::move(record));
+        }
+
+        /**
+         * @brief Loads a snapshot file (replacing any cached records).
+         * @param file                  File to load.
+         */
+        inline constexpr bool load(const std::string& file) {
+            auto stream = std::ifstream(file, std::ios::binary);
+            if (m_records.clear(); !stream) return false;
+
+            // validate the incoming signature first
+            auto signature = std::string(s_signature.size(), '\0');
+            if (!stream.read(signature.data(), signature.size()) || signature != s_signature) return false;
+
+            // and read all the available records
+            auto count = m_read<uint64_t>(stream);
+            for (uint64_t index = 0; stream && index < count; ++index) {
+                auto path = m_read<std::string>(stream);
+                auto record = Record();
+
+                record.stamp = m_read<Stamp>(stream);
+                record.names = m_read<std::string>(stream);
+                record.types.resize(std::min(m_read<uint64_t>(stream), s_limit));
+                stream.read(reinterpret_cast<char*>(record.types.data()), record.types.size());
+
+                // only keep the record if fully read (with every type in range)
+                auto typed = std::ranges::all_of(record.types, [](auto type) { return type <= Archetype::SYMLINK; });
+                if (stream && typed) m_records.insert_or_assign(std::move(path), std::move(record));
+            }
+
+            // invalidate everything when the file was truncated
+            if (!stream) m_records.clear();
+            return bool(stream);
+        }
+
+        /**
+         * @brief Saves the snapshot to a file.
+         * @param file                  File to write.
+         */
+        inline constexpr bool save(const std::string& file) const {
+            auto stream = std::ofstream(file, std::ios::binary | std::ios::trunc);
+            if (!stream) return false;
+
+            // write the signature and all records now
+            stream.write(s_signature.data(), s_signature.size());
+            m_write<uint64_t>(stream, m_records.size());
+
+            for (const auto& [path, record] : m_records) {
+                m_write(stream, path), m_write(stream, record.stamp), m_write(stream, record.names);
+                m_write<uint64_t>(stream, record.types.size());
+                stream.write(reinterpret_cast<const char*>(record.types.data()), record.types.size());
+            }
+
+            // and declare if successful
+            return bool(stream.flush());
+        }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /**
+         * @brief Checks if a stamp is too recent to be trusted.
+         * @param stamp                 Stamp to check.
+         */
+        inline constexpr bool m_racy(const Stamp& stamp) const noexcept {
+            auto now = std::chrono::system_clock::now().time_since_epoch();
+            auto limit = std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_window).count();
+            return stamp.modified >= limit || stamp.changed >= limit;
+        }
+
+        /**
+         * @brief Reads a binary value.
+         * @param stream                Stream to read.
+         */
+        template <typename T>
+        static inline constexpr T m_read(std::istream& stream) {
+            if constexpr (std::is_same_v<T, std::string>) {
+                auto size = m_read<uint64_t>(stream);
+                if (size > s_limit) return stream.setstate(std::ios::failbit), std::string();
+
+                // otherwise read the full string now
+                auto value = std::string(size, '\0');
+                return stream.read(value.data(), value.size()), value;
+            } else {
+                auto value = T();
+                return stream.read(reinterpret_cast<char*>(&value), sizeof(T)), value;
+            }
+        }
+
+        /**
+         * @brief Writes a binary value.
+         * @param stream                Stream to write.
+         * @param value                 Value to write.
+         */
+        template <typename T>
+        static inline constexpr void m_write(std::ostream& stream, const T& value) {
+            if constexpr (std::is_same_v<T, std::string>) {
+                m_write<uint64_t>(stream, value.size()), stream.write(value.data(), value.size());
+            } else {
+                stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+            }
+        }
+    };
+
+}  // namespace Aster
+
+#endif
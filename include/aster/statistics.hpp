@@ -0,0 +1,103 @@
+#ifndef _ASTER_STATISTICS_HPP
+#define _ASTER_STATISTICS_HPP
+
+/// C++ Includes
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+/// Aster Includes
+#include "aster/entry.hpp"
+
+/// @brief Denotes if walks record statistics (otherwise all recording compiles away).
+#ifndef ASTER_STATISTICS_ENABLED
+#define ASTER_STATISTICS_ENABLED 0
+#endif
+
+namespace Aster {
+
+    /// @brief Walk Statistics (accumulated across every walk given them through `Options::statistics`).
+    struct Statistics {
+        //  PROPERTIES  //
+
+        uint64_t opened = 0;    // Directories opened.
+        uint64_t failed = 0;    // Directories that failed to open (per attempt).
+        uint64_t entries = 0;   // Entries read.
+        uint64_t tested = 0;    // Entries tested against the patterns.
+        uint64_t matched = 0;   // Entries matched.
+        uint64_t pruned = 0;    // Directories not descended into.
+        uint64_t pending = 0;   // Peak number of directories waiting to be opened.
+        uint64_t bytes = 0;     // Bytes allocated for paths (listed entries, path buffers and pending directories).
+
+        /// @brief Entries read by type (indexed by `Archetype`).
+        std::array<uint64_t, 4> types = {};
+
+        /// @brief Wall time spent opening and reading directories.
+        std::chrono::nanoseconds syscalls = {};
+
+        /// @brief Wall time spent testing entries (and queueing directories).
+        std::chrono::nanoseconds matching = {};
+
+        /// @brief Denotes if recording was compiled in.
+        static constexpr bool enabled = ASTER_STATISTICS_ENABLED;
+    };
+
+    namespace Detail {
+
+        /**
+         * @brief Gets the heap bytes held by a string (none whilst stored inline).
+         * @param value             String to measure.
+         */
+        static inline constexpr size_t heap(const std::string& value) noexcept {
+            return value.capacity() > std::string().capacity() ? value.capacity() + 1 : 0;
+        }
+
+        /// @brief Scoped Wall Time Recorder (an empty no-op unless statistics are enabled).
+        class Stopwatch {
+            //  TYPEDEFS  //
+
+            /// @brief Monotonic clock typing.
+            using Clock = std::chrono::steady_clock;
+
+#if ASTER_STATISTICS_ENABLED
+            //  PROPERTIES  //
+
+            /// @brief Duration to accumulate into (if any).
+            std::chrono::nanoseconds* m_total = nullptr;
+
+            /// @brief The starting time.
+            Clock::time_point m_start = {};
+#endif
+
+           public:
+            //  CONSTRUCTORS  //
+
+            /**
+             * @brief Starts timing (when statistics are given).
+             * @param statistics        Statistics to record into (if any).
+             * @param total             Duration member to accumulate into.
+             */
+            constexpr Stopwatch(Statistics* statistics, std::chrono::nanoseconds Statistics::* total) {
+#if ASTER_STATISTICS_ENABLED
+                if (statistics != nullptr) m_total = &(statistics->*total), m_start = Clock::now();
+#else
+                (void)statistics, (void)total;
+#endif
+            }
+
+            constexpr Stopwatch(const Stopwatch&) = delete;
+
+            /// @brief Accumulates the elapsed time.
+            constexpr ~Stopwatch() {
+#if ASTER_STATISTICS_ENABLED
+                if (m_total != nullptr) *m_total += Clock::now() - m_start;
+#endif
+            }
+        };
+
+    }  // namespace Detail
+
+}  // namespace Aster
+
+#endif
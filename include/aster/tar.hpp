@@ -0,0 +1,151 @@
+#ifndef _ASTER_TAR_HPP
+#define _ASTER_TAR_HPP
+
+/// C++ Includes
+#include <fstream>
+#include <iterator>
+#include <numeric>
+
+/// Aster Includes
+#include "aster/memory.hpp"
+
+namespace Aster {
+
+    /// @brief Tar Archive Backend (ustar, GNU long names and pax paths).
+    class Tar : public Memory {
+        //  PROPERTIES  //
+
+        /// @brief Size of each archive block.
+        static constexpr size_t s_block = 512;
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /**
+         * @brief Constructs a tree from an archive stream.
+         * @param root                  Root directory (walks set `Options::cwd` to it).
+         * @param archive               Archive stream (parsing stops at the first invalid header).
+         */
+        constexpr Tar(const std::string& root, std::istream& archive) : Memory(root) {
+            m_parse(std::string(std::istreambuf_iterator<char>(archive), std::istreambuf_iterator<char>()));
+        }
+
+        /**
+         * @brief Constructs a tree from an archive file.
+         * @param root                  Root directory (walks set `Options::cwd` to it).
+         * @param file                  Archive file (empty if unreadable).
+         */
+        constexpr Tar(const std::string& root, const std::string& file) : Memory(root) {
+            auto stream = std::ifstream(file, std::ios::binary);
+            m_parse(std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()));
+        }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /**
+         * @brief Handles parsing all archive headers.
+         * @param data                  Archive contents.
+         */
+        inline constexpr void m_parse(std::string_view data) {
+            std::string override = {};  // long name for the next header (if any)
+            for (size_t offset = 0; offset + s_block <= data.size();) {
+                auto header = data.substr(offset, s_block);
+                if (!m_valid(header)) break;  // end-of-archive (or corrupt)
+
+                // resolve the entry name (ustar names may be split with a prefix)
+                auto name = override.size() ? override : m_field(header.substr(0, 100));
+                auto prefix = header.substr(257, 5) == "ustar" ? m_field(header.substr(345, 155)) : "";
+                if (override.empty() && prefix.size()) name = prefix + '/' + name;
+
+                // skip over the entry contents now
+                auto size = std::min<size_t>(m_number(header.substr(124, 12)), data.size());
+                auto body = data.substr(std::min(offset + s_block, data.size()), size);
+                offset += s_block + (size + s_block - 1) / s_block * s_block;
+
+                // and handle the entry by type
+                switch (override.clear(); header[156]) {
+                    case 'L': override = m_field(body); break;  // GNU long name
+                    case 'x': override = m_pax(body); break;    // pax extended path
+                    case '5': add(name, Archetype::DIRECTORY); break;
+                    case '2': add(name, Archetype::SYMLINK); break;
+                    case '\0':
+                    case '0':
+                    case '1':
+                    case '7': add(name, Archetype::REGULAR); break;
+                    default: break;  // devices, fifos and global headers
+                }
+            }
+        }
+
+        /**
+         * @brief Checks a header against its checksum (all-zero blocks end the archive).
+         * @param header                Header block.
+         */
+        static inline constexpr bool m_valid(std::string_view header) noexcept {
+            auto sum = std::accumulate(header.begin(), header.end(), uint64_t(0), [](auto total, char ch) {
+                return total + uint8_t(ch);
+            });
+
+            // the checksum is computed with its own field as spaces
+            auto checksum = header.substr(148, 8);
+            sum -= std::accumulate(checksum.begin(), checksum.end(), uint64_t(0), [](auto total, char ch) {
+                return total + uint8_t(ch);
+            });
+
+            // and compare against the stored checksum
+            return sum && sum + ' ' * checksum.size() == m_number(checksum);
+        }
+
+        /**
+         * @brief Reads a NUL-terminated header field.
+         * @param field                 Field bytes.
+         */
+        static inline constexpr std::string m_field(std::string_view field) {
+            return std::string(field.substr(0, field.find('\0')));
+        }
+
+        /**
+         * @brief Reads a numeric header field (octal or base-256).
+         * @param field                 Field bytes.
+         */
+        static inline constexpr uint64_t m_number(std::string_view field) noexcept {
+            uint64_t value = 0;
+            if (field.size() && uint8_t(field[0]) & 0x80) {
+                for (size_t index = 1; index < field.size(); ++index) value = value << 8 | uint8_t(field[index]);
+                return value;
+            }
+
+            // otherwise parse the (space or NUL padded) octal digits
+            for (auto ch : field) {
+                if (ch >= '0' && ch <= '7') value = value << 3 | uint64_t(ch - '0');
+                else if (value || (ch != ' ' && ch != '\0')) break;
+            }
+
+            // and resolve the resulting value
+            return value;
+        }
+
+        /**
+         * @brief Reads the path of a pax extended header ("<length> path=<value>\n" records).
+         * @param records               Extended header records.
+         */
+        static inline constexpr std::string m_pax(std::string_view records) {
+            while (records.size()) {
+                auto ending = std::min(records.find('\n'), records.size());
+                auto record = records.substr(0, ending);
+                records.remove_prefix(std::min(ending + 1, records.size()));
+
+                // check for the path keyword
+                auto key = record.find(" path=");
+                if (key != record.npos) return std::string(record.substr(key + 6));
+            }
+
+            // no path was provided
+            return "";
+        }
+    };
+
+}  // namespace Aster
+
+#endif
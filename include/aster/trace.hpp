@@ -0,0 +1,162 @@
+#ifndef _ASTER_TRACE_HPP
+#define _ASTER_TRACE_HPP
+
+/// C++ Includes
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+namespace Aster {
+
+    /// @brief Directory Trace Phases.
+    enum class Phase : uint8_t {
+        OPEN,   // the directory was opened (or failed to open)
+        CLOSE,  // the directory was finished with (or the walk stopped)
+    };
+
+    /// @brief Directory Trace Event.
+    struct Trace {
+        //  TYPEDEFS  //
+
+        /// @brief Monotonic clock typing.
+        using Clock = std::chrono::steady_clock;
+
+        //  PROPERTIES  //
+
+        /// @brief Directory path.
+        std::string path = "";
+
+        /// @brief Current phase.
+        Phase phase = Phase::OPEN;
+
+        /// @brief Failure opening the directory (if any).
+        std::error_code error = {};
+
+        /// @brief Entries read so far.
+        uint64_t entries = 0;
+
+        /// @brief Entries matched so far.
+        uint64_t matches = 0;
+
+        /// @brief Time spent opening and reading the directory so far.
+        std::chrono::nanoseconds reading = {};
+
+        /// @brief When the directory started opening.
+        Clock::time_point start = Clock::now();
+    };
+
+    /// @brief Chrome Trace-Event Exporter (writes each finished directory as a complete "X" event).
+    class Chrome {
+        //  PROPERTIES  //
+
+        /// @brief Output stream.
+        std::ostream* m_output = nullptr;
+
+        /// @brief Guards the output (walks may trace from many threads).
+        std::mutex m_mutex = {};
+
+        /// @brief Trace starting time (event timestamps are relative to it).
+        Trace::Clock::time_point m_epoch = Trace::Clock::now();
+
+        /// @brief Denotes if an event was written.
+        bool m_written = false;
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /**
+         * @brief Starts a trace (in the JSON array format).
+         * @param output                Stream to write to (must outlive the exporter).
+         */
+        explicit Chrome(std::ostream& output) : m_output(&output) { *m_output << "[\n"; }
+
+        Chrome(const Chrome&) = delete;
+
+        /// @brief Ends the trace.
+        ~Chrome() { *m_output << "\n]\n" << std::flush; }
+
+        //  PUBLIC METHODS  //
+
+        /// @brief Gets a callback for `Options::trace` (bound to this exporter).
+        inline std::function<void(const Trace&)> hook() {
+            return [this](const Trace& trace) { record(trace); };
+        }
+
+        /**
+         * @brief Records a trace event (only closing events are written).
+         * @param trace                 Trace event.
+         */
+        inline void record(const Trace& trace) {
+            if (trace.phase != Phase::CLOSE) return;  // complete events carry their own duration
+
+            // timestamps and durations are in microseconds
+            using Microseconds = std::chrono::duration<double, std::micro>;
+            auto timestamp = Microseconds(trace.start - m_epoch).count();
+            auto duration = Microseconds(Trace::Clock::now() - trace.start).count();
+            auto reading = Microseconds(trace.reading).count();
+            auto thread = std::hash<std::thread::id>()(std::this_thread::get_id()) % 1000000;
+
+            // format the event upfront (so the lock is only held whilst writing)
+            auto event = std::string("{\"name\":\"") + m_escape(trace.path) + "\",\"cat\":\"directory\",\"ph\":\"X\"";
+            event += ",\"ts\":" + m_number(timestamp) + ",\"dur\":" + m_number(duration);
+            event += ",\"pid\":1,\"tid\":" + std::to_string(thread) + ",\"args\":{";
+            event += "\"entries\":" + std::to_string(trace.entries) + ",\"matches\":" + std::to_string(trace.matches);
+            event += ",\"readdir_us\":" + m_number(reading);
+            if (trace.error) event += ",\"error\":\"" + m_escape(trace.error.message()) + "\"";
+            event += "}}";
+
+            // and write the event now
+            auto lock = std::lock_guard(m_mutex);
+            *m_output << (std::exchange(m_written, true) ? ",\n" : "") << event;
+        }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /**
+         * @brief Formats a number of microseconds.
+         * @param value                 Value to format.
+         */
+        static inline std::string m_number(double value) {
+            char buffer[32] = {};
+            return std::snprintf(buffer, sizeof(buffer), "%.3f", value), buffer;
+        }
+
+        /**
+         * @brief Escapes a JSON string value.
+         * @param value                 Value to escape.
+         */
+        static inline std::string m_escape(std::string_view value) {
+            std::string escaped = {};
+            for (auto ch : value) {
+                switch (ch) {
+                    case '"': escaped += "\\\""; break;
+                    case '\\': escaped += "\\\\"; break;
+                    case '\n': escaped += "\\n"; break;
+                    case '\t': escaped += "\\t"; break;
+                    default: {
+                        if (uint8_t(ch) >= 0x20) escaped += ch;
+                        else {
+                            char buffer[8] = {};
+                            std::snprintf(buffer, sizeof(buffer), "\\u%04x", unsigned(ch)), escaped += buffer;
+                        }
+                    }
+                }
+            }
+
+            // resolve the escaped value
+            return escaped;
+        }
+    };
+
+}  // namespace Aster
+
+#endif
@@ -1,16 +1,51 @@
 #ifndef _ASTER_TRAVERSAL_UNIX_HPP
 #define _ASTER_TRAVERSAL_UNIX_HPP
 
+/// C++ Includes
+#include <cerrno>
+#include <functional>
+#include <span>
+#include <system_error>
+
 /// Aster Includes
-#include "aster/entry.hpp"
+#include "aster/listing.hpp"
 
 #ifdef _ASTER_PLATFORM_UNIX
 
 /// OS Includes
 #include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
 
 namespace Aster::Detail {
 
+    /// @brief Callback resolving the types of entries listed without one (given the open directory descriptor).
+    using Resolver = std::function<void(int, std::span<Entry* const>)>;
+
+    /**
+     * @brief Gets the archetype of a file mode.
+     * @param mode                  File mode.
+     */
+    static inline constexpr Archetype archetype(mode_t mode) noexcept {
+        if (S_ISREG(mode)) return Archetype::REGULAR;
+        if (S_ISLNK(mode)) return Archetype::SYMLINK;
+        if (S_ISDIR(mode)) return Archetype::DIRECTORY;
+        return Archetype::INVALID;
+    }
+
+    /**
+     * @brief Resolves entry types one `fstatat` at a time (the default resolver).
+     * @param directory             Open directory descriptor.
+     * @param entries               Entries to resolve (by their final path segment).
+     */
+    static inline void resolve(int directory, std::span<Entry* const> entries) {
+        struct ::stat status = {};
+        for (auto* entry : entries) {
+            auto name = entry->path.c_str() + entry->path.find_last_of('/') + 1;
+            if (::fstatat(directory, name, &status, AT_SYMLINK_NOFOLLOW) == 0) entry->type = archetype(status.st_mode);
+        }
+    }
+
     /// @brief Directory Traversal Implementation.
     class Traversal {
         //  PROPERTIES  //
@@ -21,18 +56,46 @@ namespace Aster::Detail {
         /// @brief Directory descriptor.
         ::DIR* m_descriptor = nullptr;
 
+        /// @brief Failure opening the directory (if any).
+        std::error_code m_error = {};
+
         /// @brief The prefix directory value.
         std::string m_prefix = Detail::getcwd();
 
+        /// @brief Sorted listing (when buffered).
+        Listing m_listing = {};
+
+        /// @brief Denotes if entries are served from the listing.
+        bool m_buffered = false;
+
        public:
         //  CONSTRUCTORS  //
 
         /**
          * @brief Constructs a UNIX directory traverser.
          * @param prefix                The prefix directory.
+         * @param sorting               Listing sort order.
+         * @param buffered              Buffer the full listing upfront.
+         * @param resolver              Resolves untyped entries of buffered listings in one batch (`fstatat` if empty).
          */
-        constexpr Traversal(const std::string& prefix = Detail::getcwd()) :
-            m_descriptor(::opendir(prefix.c_str())), m_prefix(prefix) {}
+        constexpr Traversal(const std::string& prefix = Detail::getcwd(), Sorting sorting = Sorting::NONE,
+                            bool buffered = false, const Resolver& resolver = {}) :
+            m_descriptor(::opendir(prefix.c_str())),
+            m_error(m_descriptor ? 0 : errno, std::generic_category()),
+            m_prefix(prefix) {
+            if (buffered || sorting != Sorting::NONE) m_buffer(sorting, resolver);
+        }
+
+        /**
+         * @brief Constructs a traverser over a previously buffered listing.
+         * @param prefix                The prefix directory.
+         * @param listing               Listing to serve.
+         * @param sorting               Listing sort order.
+         */
+        constexpr Traversal(const std::string& prefix, Listing&& listing, Sorting sorting = Sorting::NONE) :
+            m_prefix(prefix), m_listing(std::move(listing)), m_buffered(true) {
+            m_listing.sort(sorting);
+        }
 
         /// @brief Ensures we close a directory when necessary.
         constexpr ~Traversal() { m_release(); }
@@ -40,18 +103,32 @@ namespace Aster::Detail {
         //  PUBLIC METHODS  //
 
         /// @brief Denotes if currently done.
-        inline constexpr bool done() const noexcept { return m_descriptor == nullptr; }
+        inline constexpr bool done() const noexcept { return m_descriptor == nullptr && m_listing.empty(); }
+
+        /// @brief Gets the failure opening the directory (if any).
+        inline constexpr const std::error_code& error() const noexcept { return m_error; }
 
         /// @brief Gets the current iterator value.
         inline constexpr const Entry& current() const noexcept { return m_current; }
 
+        /// @brief Gets the buffered listing (empty unless buffered).
+        inline constexpr const Listing& listing() const noexcept { return m_listing; }
+
         /// @brief Advances the state of the traverser.
-        inline constexpr const Entry& advance() {
+        inline constexpr Entry& advance() {
+            // serve buffered listings directly
+            if (m_buffered) return m_current = m_listing.pop(), m_current;
+
             // stop whenever the descriptor is invalid
             if (m_descriptor == nullptr) return m_current;
 
             // attempt reading descriptors whilst we possibly can
-            do { m_current = m_classify(::readdir(m_descriptor)); } while (m_ignored());
+            do { m_classify(::readdir(m_descriptor)); } while (m_ignored());
+
+            // streamed entries without a type (on filesystems lacking `d_type`) are resolved one at a time
+            if (auto current = &m_current; current->type == Archetype::INVALID && current->path.size()) {
+                resolve(::dirfd(m_descriptor), std::span(&current, 1));
+            }
 
             // remove the descriptor when complete
             if (m_current.path == "") m_release();
@@ -63,6 +140,32 @@ namespace Aster::Detail {
        private:
         //  PRIVATE METHODS  //
 
+        /**
+         * @brief Buffers the full directory listing in sorted order.
+         * @param sorting               Listing sort order.
+         * @param resolver              Resolves untyped entries in one batch (`fstatat` if empty).
+         */
+        inline constexpr void m_buffer(Sorting sorting, const Resolver& resolver) {
+            std::vector<Entry> entries = {};
+            for (; m_descriptor != nullptr; entries.emplace_back(std::move(m_current))) {
+                do { m_classify(::readdir(m_descriptor)); } while (m_ignored());
+                if (m_current.path.empty()) break;
+            }
+
+            // untyped entries are resolved together whilst the directory is still open
+            std::vector<Entry*> untyped = {};
+            for (auto& entry : entries) {
+                if (entry.type == Archetype::INVALID) untyped.push_back(&entry);
+            }
+
+            if (untyped.size() && resolver) resolver(::dirfd(m_descriptor), untyped);
+            else if (untyped.size()) resolve(::dirfd(m_descriptor), untyped);
+
+            // and then serve the listing instead
+            for (m_release(); auto& entry : entries) m_listing.push(std::move(entry));
+            m_listing.sort(sorting), m_buffered = true;
+        }
+
         /// @brief Handles releasing the traversal descriptor.
         inline constexpr void m_release() {
             if (m_descriptor == nullptr) return;  // completed
@@ -82,15 +185,16 @@ namespace Aster::Detail {
          * @brief Handles classifying entries.
          * @param entry                 Entry to classify.
          */
-        inline constexpr Entry m_classify(struct dirent* entry) const noexcept {
+        inline constexpr void m_classify(struct dirent* entry) {
             // fail when necessary to do so
-            if (entry == nullptr) return {};
+            if (entry == nullptr) return void(m_current = {});
 
-            std::string suffix = entry->d_name;  // prepare the path details
-            auto path = m_ignored(suffix) ? suffix : Detail::join(m_prefix, suffix);
+            std::string_view suffix = entry->d_name;  // prepare the path details
+            if (m_ignored(suffix)) return void(m_current.path.assign(suffix));
 
-            // and resolve the outgoing path to be used now
-            return { path, m_archetype(entry) };
+            // and resolve the outgoing path into the reused buffer now
+            Detail::join(m_current.path, m_prefix, suffix);
+            m_current.type = m_archetype(entry), m_current.mask = 0;
         }
 
         /**
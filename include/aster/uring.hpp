@@ -0,0 +1,268 @@
+#ifndef _ASTER_URING_HPP
+#define _ASTER_URING_HPP
+
+/// C++ Includes
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <memory>
+#include <span>
+#include <vector>
+
+/// Aster Includes
+#include "aster/backend.hpp"
+
+#if defined(_ASTER_PLATFORM_LINUX) && __has_include(<linux/io_uring.h>)
+/// OS Includes
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#if defined(STATX_TYPE) && defined(__NR_io_uring_setup)
+#define _ASTER_PLATFORM_URING
+#endif
+#endif
+
+namespace Aster {
+
+    namespace Detail {
+
+#ifdef _ASTER_PLATFORM_URING
+        /// @brief Minimal io_uring Instance (batching `statx` calls).
+        class Ring {
+            //  PROPERTIES  //
+
+            /// @brief Ring descriptor.
+            int m_descriptor = -1;
+
+            /// @brief Maximum requests in flight.
+            unsigned m_depth = 0;
+
+            /// @brief Mapped submission ring, completion ring and submission entries (with their sizes).
+            void* m_submissions = MAP_FAILED;
+            void* m_completions = MAP_FAILED;
+            void* m_entries = MAP_FAILED;
+            size_t m_sizes[3] = {};
+
+            /// @brief Ring parameters (holding the offsets into the mappings).
+            io_uring_params m_parameters = {};
+
+            /// @brief Request results (owned by the ring, since abandoned requests may still complete).
+            std::vector<struct ::statx> m_results = {};
+
+           public:
+            //  CONSTRUCTORS  //
+
+            /**
+             * @brief Sets up a ring (check `valid()`, since io_uring may be unavailable or disallowed).
+             * @param depth             Maximum requests in flight.
+             */
+            explicit Ring(unsigned depth) : m_depth(std::max(depth, 1u)) {
+                m_descriptor = int(::syscall(__NR_io_uring_setup, m_depth, &m_parameters));
+                if (m_descriptor < 0) return;
+
+                // map each region of the ring
+                auto& submissions = m_parameters.sq_off;
+                auto& completions = m_parameters.cq_off;
+                m_sizes[0] = submissions.array + m_parameters.sq_entries * sizeof(unsigned);
+                m_sizes[1] = completions.cqes + m_parameters.cq_entries * sizeof(io_uring_cqe);
+                m_sizes[2] = m_parameters.sq_entries * sizeof(io_uring_sqe);
+                m_submissions = m_map(m_sizes[0], IORING_OFF_SQ_RING);
+                m_completions = m_map(m_sizes[1], IORING_OFF_CQ_RING);
+                m_entries = m_map(m_sizes[2], IORING_OFF_SQES);
+                if (!valid()) m_release();
+            }
+
+            Ring(const Ring&) = delete;
+
+            /// @brief Ensures the ring is released.
+            ~Ring() { m_release(); }
+
+            //  PUBLIC METHODS  //
+
+            /// @brief Denotes if the ring is usable.
+            inline bool valid() const noexcept {
+                auto mapped = m_submissions != MAP_FAILED && m_completions != MAP_FAILED && m_entries != MAP_FAILED;
+                return m_descriptor >= 0 && mapped;
+            }
+
+            /// @brief Gets the maximum requests in flight.
+            inline unsigned depth() const noexcept { return m_depth; }
+
+            /**
+             * @brief Resolves entry types with batched `statx` requests (keeping up to `depth()` in flight).
+             * @param directory         Open directory descriptor.
+             * @param entries           Entries to resolve (by their final path segment).
+             * @returns False if the ring failed (it is then released, leaving the entries to the caller).
+             */
+            inline bool resolve(int directory, std::span<Entry* const> entries) {
+                m_results.resize(entries.size());
+                size_t queued = 0, flight = 0, pending = 0;
+
+                while (queued < entries.size() || flight) {
+                    // queue requests whilst there is room in flight
+                    for (; queued < entries.size() && flight + pending < m_depth; ++queued, ++pending) {
+                        auto name = entries[queued]->path.c_str() + entries[queued]->path.find_last_of('/') + 1;
+                        m_queue(directory, name, &m_results[queued], queued);
+                    }
+
+                    // submit them (waiting for at least one completion)
+                    auto flags = IORING_ENTER_GETEVENTS;
+                    auto submitted = ::syscall(__NR_io_uring_enter, m_descriptor, pending, 1, flags, nullptr, 0);
+                    auto retry = errno == EINTR || errno == EAGAIN || errno == EBUSY;
+                    if (submitted < 0 && !retry) return m_release(), false;  // abandoned requests keep their results
+                    if (submitted > 0) pending -= size_t(submitted), flight += size_t(submitted);
+
+                    // and reap every completion now
+                    flight -= m_reap([&](uint64_t tag, int32_t result) {
+                        if (result == 0) entries[tag]->type = archetype(m_results[tag].stx_mode);
+                    });
+                }
+
+                // failed requests (such as kernels without `statx` support) are retried through `fstatat`
+                std::vector<Entry*> untyped = {};
+                for (auto* entry : entries) {
+                    if (entry->type == Archetype::INVALID) untyped.push_back(entry);
+                }
+
+                return Detail::resolve(directory, untyped), true;
+            }
+
+           private:
+            //  PRIVATE METHODS  //
+
+            /**
+             * @brief Maps a region of the ring.
+             * @param size              Region size.
+             * @param offset            Region offset.
+             */
+            inline void* m_map(size_t size, off_t offset) const noexcept {
+                return ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_descriptor, offset);
+            }
+
+            /**
+             * @brief Gets a ring field (shared with the kernel).
+             * @param region            Mapped region.
+             * @param offset            Field offset.
+             */
+            static inline std::atomic_ref<unsigned> m_field(void* region, unsigned offset) noexcept {
+                return std::atomic_ref<unsigned>(*reinterpret_cast<unsigned*>(static_cast<char*>(region) + offset));
+            }
+
+            /**
+             * @brief Queues a `statx` request (without submitting it).
+             * @param directory         Directory descriptor.
+             * @param name              Entry name.
+             * @param result            Result to fill.
+             * @param tag               Request tag.
+             */
+            inline void m_queue(int directory, const char* name, struct ::statx* result, uint64_t tag) noexcept {
+                auto& offsets = m_parameters.sq_off;
+                auto tail = m_field(m_submissions, offsets.tail).load(std::memory_order_relaxed);
+                auto index = tail & m_field(m_submissions, offsets.ring_mask).load(std::memory_order_relaxed);
+
+                // fill the submission entry
+                auto& entry = static_cast<io_uring_sqe*>(m_entries)[index];
+                entry = {}, entry.opcode = IORING_OP_STATX, entry.fd = directory;
+                entry.addr = reinterpret_cast<uint64_t>(name), entry.len = STATX_TYPE;
+                entry.off = reinterpret_cast<uint64_t>(result), entry.statx_flags = AT_SYMLINK_NOFOLLOW;
+                entry.user_data = tag;
+
+                // and publish it to the kernel
+                reinterpret_cast<unsigned*>(static_cast<char*>(m_submissions) + offsets.array)[index] = index;
+                m_field(m_submissions, offsets.tail).store(tail + 1, std::memory_order_release);
+            }
+
+            /**
+             * @brief Reaps every available completion.
+             * @param completed         Callback taking each completions tag and result.
+             * @returns The number of completions reaped.
+             */
+            template <typename Completed>
+            inline size_t m_reap(Completed&& completed) noexcept {
+                auto& offsets = m_parameters.cq_off;
+                auto head = m_field(m_completions, offsets.head).load(std::memory_order_relaxed);
+                auto tail = m_field(m_completions, offsets.tail).load(std::memory_order_acquire);
+                auto mask = m_field(m_completions, offsets.ring_mask).load(std::memory_order_relaxed);
+
+                // handle each completion in turn
+                auto completions = reinterpret_cast<io_uring_cqe*>(static_cast<char*>(m_completions) + offsets.cqes);
+                for (auto index = head; index != tail; ++index) {
+                    completed(completions[index & mask].user_data, completions[index & mask].res);
+                }
+
+                // and release them back to the kernel
+                m_field(m_completions, offsets.head).store(tail, std::memory_order_release);
+                return tail - head;
+            }
+
+            /// @brief Handles releasing the ring.
+            inline void m_release() noexcept {
+                void* regions[3] = { m_submissions, m_completions, m_entries };
+                for (size_t index = 0; index < 3; ++index) {
+                    if (regions[index] != MAP_FAILED) ::munmap(regions[index], m_sizes[index]);
+                }
+
+                // and close the ring itself now
+                if (m_descriptor >= 0) ::close(m_descriptor);
+                m_submissions = m_completions = m_entries = MAP_FAILED, m_descriptor = -1;
+            }
+        };
+#endif
+
+    }  // namespace Detail
+
+    /**
+     * @brief io_uring Filesystem Backend (resolving untyped entries in batches, falling back to `fstatat`).
+     * @note On filesystems filling in `d_type` every entry is already typed, so this only buffers each listing.
+     */
+    struct Uring {
+        //  PROPERTIES  //
+
+        /// @brief Maximum `statx` requests in flight.
+        unsigned depth = 64;
+
+        //  PUBLIC METHODS  //
+
+        /// @brief Denotes if io_uring is usable on this thread (otherwise walks fall back to `fstatat`).
+        inline bool available() const { return m_ring() != nullptr; }
+
+        /**
+         * @brief Opens a directory traversal (always buffered, so untyped entries resolve in one batch).
+         * @param path              Directory path.
+         * @param sorting           Listing sort order.
+         */
+        inline std::shared_ptr<Detail::Traversal> open(const std::string& path, Sorting sorting, bool) const {
+#ifdef _ASTER_PLATFORM_URING
+            auto resolver = [this](int directory, std::span<Entry* const> entries) {
+                auto ring = m_ring();
+                if (ring == nullptr || !ring->resolve(directory, entries)) Detail::resolve(directory, entries);
+            };
+
+            return std::make_shared<Detail::Traversal>(path, sorting, true, resolver);
+#else
+            return std::make_shared<Detail::Traversal>(path, sorting, true);
+#endif
+        }
+
+       private:
+        //  PRIVATE METHODS  //
+
+#ifdef _ASTER_PLATFORM_URING
+        /// @brief Gets this threads ring (null when unavailable).
+        inline Detail::Ring* m_ring() const {
+            thread_local auto s_ring = std::unique_ptr<Detail::Ring>();
+            auto clamped = std::max(depth, 1u);  // as rings clamp their depth (so zero still reuses the ring)
+            if (s_ring == nullptr || s_ring->depth() != clamped) s_ring = std::make_unique<Detail::Ring>(clamped);
+            return s_ring->valid() ? s_ring.get() : nullptr;
+        }
+#else
+        inline constexpr void* m_ring() const noexcept { return nullptr; }
+#endif
+    };
+
+}  // namespace Aster
+
+#endif
@@ -1,8 +1,16 @@
 #ifndef _ASTER_WALKER_HPP
 #define _ASTER_WALKER_HPP
 
+/// C++ Includes
+#include <deque>
+#include <stdexcept>
+#include <vector>
+
 /// Aster Includes
+#include "aster/async.hpp"
+#include "aster/content.hpp"
 #include "aster/iterator.hpp"
+#include "aster/parallel.hpp"
 
 namespace Aster {
 
@@ -33,9 +41,232 @@ namespace Aster {
         /**
          * @brief Initiates an iteration sequence.
          * @param options               Iteration options.
+         * @param backend               Traversal backend.
+         */
+        template <Backend Source = Detail::System>
+        inline constexpr BasicIterator<Source> iterate(const Options& options = {}, const Source& backend = {}) const {
+            return ++BasicIterator<Source>(&m_pattern, options, backend);  // construct the iterator now
+        }
+
+        /**
+         * @brief Walks pushing every match to a visitor.
+         * @param options               Iteration options.
+         * @param visitor               Callback taking a `const Entry&` and returning a `Visit` action (or void).
+         * @param backend               Traversal backend.
+         * @returns False if the walk was stopped early.
+         */
+        template <typename Visitor, Backend Source = Detail::System>
+        inline constexpr bool visit(const Options& options, Visitor&& visitor, const Source& backend = {}) const {
+            return BasicIterator<Source>(&m_pattern, options, backend).visit(std::forward<Visitor>(visitor));
+        }
+
+        /**
+         * @brief Checks if any entry matches (stopping at the first match).
+         * @param options               Iteration options.
+         * @param backend               Traversal backend.
+         */
+        template <Backend Source = Detail::System>
+        inline constexpr bool exists(const Options& options = {}, const Source& backend = {}) const {
+            return !visit(options, [](const Entry&) { return Visit::STOP; }, backend);
+        }
+
+        /**
+         * @brief Counts all matching entries (without copying any of them).
+         * @param options               Iteration options.
+         * @param backend               Traversal backend.
+         */
+        template <Backend Source = Detail::System>
+        inline constexpr size_t count(const Options& options = {}, const Source& backend = {}) const {
+            size_t count = 0;  // only the tally is kept
+            return visit(options, [&](const Entry&) { ++count; }, backend), count;
+        }
+
+        /**
+         * @brief Collects up to the first `n` matching entries (stopping once found).
+         * @param options               Iteration options.
+         * @param n                     Maximum entries to collect.
+         * @param backend               Traversal backend.
+         */
+        template <Backend Source = Detail::System>
+        inline constexpr std::vector<Entry> first(const Options& options, size_t n, const Source& backend = {}) const {
+            std::vector<Entry> entries = {};
+            if (n == 0) return entries;  // nothing to walk for
+
+            // collect entries until the limit is reached
+            visit(options, [&](const Entry& entry) {
+                entries.emplace_back(entry);
+                return entries.size() < n ? Visit::CONTINUE : Visit::STOP;
+            }, backend);
+
+            // and resolve the collected entries
+            return entries;
+        }
+
+        /**
+         * @brief Walks reading every matched regular file, whilst the next few are read ahead.
+         * @param options               Iteration options.
+         * @param visitor               Callback taking a `const Entry&` and its `std::string_view` content, and
+         *                              returning a `Visit` action (or void).
+         * @param lookahead             Matched files opened (and read ahead) before the current one is visited.
+         * @returns False if the walk was stopped early.
+         */
+        template <typename Visitor>
+        inline constexpr bool read(const Options& options, Visitor&& visitor, size_t lookahead = 8) const {
+            auto window = std::deque<std::pair<Entry, Content>>();
+
+            // hands the oldest file over to the visitor
+            auto deliver = [&]() {
+                auto& [entry, content] = window.front();
+                auto action = Visit::CONTINUE;
+
+                // void visitors always continue
+                if constexpr (std::is_void_v<std::invoke_result_t<Visitor&, const Entry&, std::string_view>>) {
+                    visitor(std::as_const(entry), content.view());
+                } else action = visitor(std::as_const(entry), content.view());
+
+                // and release the file now
+                return window.pop_front(), action != Visit::STOP;
+            };
+
+            // queue each matched file, visiting once the window is full
+            auto completed = visit(options, [&](const Entry& entry) {
+                if (entry.type != Archetype::REGULAR) return Visit::CONTINUE;
+                window.emplace_back(entry, Content(entry.path));
+                return window.size() <= lookahead || deliver() ? Visit::CONTINUE : Visit::STOP;
+            });
+
+            // and drain any remaining files
+            while (completed && window.size()) completed = deliver();
+            return completed;
+        }
+
+        /**
+         * @brief Walks on several threads, pushing every match to a consumer on whichever worker is free.
+         * @param options               Iteration options (sorting, orders, snapshots, statistics and traces unused).
+         * @param consumer              Thread-safe callback taking a `const Entry&` and returning a `Visit` action (or
+         *                              void), along with any `Options::error` handler.
+         * @param threads               Worker threads, including the calling thread (the hardware concurrency when 0).
+         * @param backend               Traversal backend.
+         * @note Workers only walk whilst no matches are waiting, so walking and consuming overlap; `Visit::SKIP`
+         *       never prunes (directories are queued before their entries are consumed).
+         * @returns False if the walk was stopped early.
+         */
+        template <typename Consumer, Backend Source = Detail::System>
+        inline bool parallel_for_each(
+            const Options& options, Consumer&& consumer, size_t threads = 0, const Source& backend = {}) const {
+            auto patterns = std::span<const Pattern>(&m_pattern, 1);
+            return Detail::Parallel<Source, std::remove_reference_t<Consumer>>(
+                patterns, options, consumer, threads, backend).run();
+        }
+
+        /**
+         * @brief Lazily walks yielding batches of entries.
+         * @param options               Iteration options.
+         * @param size                  Maximum entries per batch.
+         */
+        inline Generator<std::vector<Entry>> batches(const Options& options, size_t size) const {
+            return m_batches(m_pattern, options, std::max<size_t>(size, 1));
+        }
+
+        /**
+         * @brief Walks asynchronously, performing the directory syscalls on an executor.
+         * @param options               Iteration options.
+         * @param executor              Callable accepting a `void()` job to run (e.g. posting to a pool).
+         * @param size                  Maximum entries per batch.
+         * @note Coroutines awaiting `Stream::next()` are resumed on the executors thread (not the callers event
+         *       loop), so any code following each `co_await` runs there too; await the event loops own scheduler
+         *       afterwards to return to it.
+         */
+        template <typename Executor>
+        inline Stream<Executor> stream(const Options& options, Executor executor, size_t size) const {
+            return Stream<Executor>(m_pattern, options, std::move(executor), size);
+        }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /**
+         * @brief Handles yielding batches (owning copies so the generator may outlive the walker).
+         * @param pattern               Glob pattern.
+         * @param options               Iteration options.
+         * @param size                  Maximum entries per batch.
+         */
+        static inline Generator<std::vector<Entry>> m_batches(Pattern pattern, Options options, size_t size) {
+            auto iterator = ++Iterator(&pattern, options);
+            for (auto batch = Detail::batch(iterator, size); batch.size(); batch = Detail::batch(iterator, size)) {
+                co_yield std::move(batch);
+            }
+        }
+    };
+
+    /// @brief Multi-Pattern Walker Instance.
+    class MultiWalker {
+        //  PROPERTIES  //
+
+        /// @brief Walker pattern values.
+        std::vector<Pattern> m_patterns = {};
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /// @brief Constructs an empty walker.
+        constexpr MultiWalker() = default;
+
+        /**
+         * @brief Constructs a multi-pattern walker instance.
+         * @param patterns              Patterns to bind (at most `Detail::capacity()`).
+         */
+        constexpr MultiWalker(std::initializer_list<Pattern> patterns) :
+            MultiWalker(std::vector<Pattern>(patterns)) {}
+        constexpr MultiWalker(const std::vector<Pattern>& patterns) : m_patterns(patterns) {
+            auto limit = Detail::capacity();  // masks only have so many bits
+            if (m_patterns.size() > limit) throw std::length_error("Aster::MultiWalker: too many patterns");
+        }
+
+        //  PUBLIC METHODS  //
+
+        /// @brief Gets the underlying walker patterns.
+        inline constexpr std::span<const Pattern> patterns() const noexcept { return m_patterns; }
+
+        /**
+         * @brief Initiates a single shared iteration sequence for all patterns.
+         * @param options               Iteration options.
+         * @param backend               Traversal backend.
+         * @note Each yielded `Entry::mask` has bit `i` set when pattern `i` matched.
+         */
+        template <Backend Source = Detail::System>
+        inline constexpr BasicIterator<Source> iterate(const Options& options = {}, const Source& backend = {}) const {
+            return ++BasicIterator<Source>(std::span<const Pattern>(m_patterns), options, backend);
+        }
+
+        /**
+         * @brief Walks once pushing every match (with its `Entry::mask`) to a visitor.
+         * @param options               Iteration options.
+         * @param visitor               Callback taking a `const Entry&` and returning a `Visit` action (or void).
+         * @param backend               Traversal backend.
+         * @returns False if the walk was stopped early.
+         */
+        template <typename Visitor, Backend Source = Detail::System>
+        inline constexpr bool visit(const Options& options, Visitor&& visitor, const Source& backend = {}) const {
+            auto iterator = BasicIterator<Source>(std::span<const Pattern>(m_patterns), options, backend);
+            return iterator.visit(std::forward<Visitor>(visitor));
+        }
+
+        /**
+         * @brief Walks once on several threads, pushing every match (with its `Entry::mask`) to a consumer.
+         * @param options               Iteration options (see `Walker::parallel_for_each`).
+         * @param consumer              Thread-safe callback taking a `const Entry&` and returning a `Visit` action (or
+         *                              void).
+         * @param threads               Worker threads, including the calling thread (the hardware concurrency when 0).
+         * @param backend               Traversal backend.
+         * @returns False if the walk was stopped early.
          */
-        inline constexpr Iterator iterate(const Options& options = {}) const noexcept {
-            return ++Iterator(&m_pattern, options);  // construct the iterator now
+        template <typename Consumer, Backend Source = Detail::System>
+        inline bool parallel_for_each(
+            const Options& options, Consumer&& consumer, size_t threads = 0, const Source& backend = {}) const {
+            auto patterns = std::span<const Pattern>(m_patterns);
+            return Detail::Parallel<Source, std::remove_reference_t<Consumer>>(
+                patterns, options, consumer, threads, backend).run();
         }
     };
 
@@ -0,0 +1,356 @@
+#ifndef _ASTER_WATCHER_HPP
+#define _ASTER_WATCHER_HPP
+
+/// C++ Includes
+#include <map>
+#include <unordered_map>
+
+/// Aster Includes
+#include "aster/iterator.hpp"
+
+#ifdef _ASTER_PLATFORM_LINUX
+
+/// OS Includes
+#include <poll.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+
+namespace Aster {
+
+    /// @brief Available Change Types.
+    enum class Change : uint8_t { CREATED, DELETED, RENAMED };
+
+    /// @brief Watcher Change Event.
+    struct Event {
+        //  PROPERTIES  //
+
+        /// @brief The type of change.
+        Change change = Change::CREATED;
+
+        /// @brief The affected entry (the new entry for renames).
+        Entry entry = {};
+
+        /// @brief The previous path (for renames only).
+        std::string previous = "";
+    };
+
+    /// @brief Live Glob Watcher (inotify).
+    class Watcher {
+        //  PROPERTIES  //
+
+        /// @brief Watched glob pattern.
+        Pattern m_pattern = Pattern("**/*");
+
+        /// @brief Watcher options.
+        Options m_options = Options();
+
+        /// @brief Associated entry filter.
+        Detail::Filter m_filter = {};
+
+        /// @brief The inotify descriptor.
+        int m_descriptor = -1;
+
+        /// @brief Watched directories (by watch descriptor).
+        std::unordered_map<int, std::string> m_watches = {};
+
+        /// @brief Watch descriptors (by ordered directory path).
+        std::map<std::string, int> m_directories = {};
+
+        /// @brief Currently matched entries.
+        std::map<std::string, Archetype> m_matched = {};
+
+        /// @brief Watched inotify events.
+        static constexpr uint32_t s_events = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF;
+
+       public:
+        //  CONSTRUCTORS  //
+
+        /**
+         * @brief Constructs a watcher, performing the initial walk.
+         * @param pattern               Pattern to watch.
+         * @param options               Watch options.
+         */
+        constexpr Watcher(const Pattern& pattern, const Options& options = {}) :
+            m_pattern(pattern),
+            m_options(options),
+            m_filter(std::span<const Pattern>(&m_pattern, 1), options),
+            m_descriptor(::inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) {
+            if (valid()) m_scan(m_options.cwd, nullptr);
+        }
+
+        /// @brief Watchers are bound to their descriptor.
+        Watcher(const Watcher&) = delete;
+        Watcher& operator=(const Watcher&) = delete;
+
+        /// @brief Ensures the inotify descriptor is released.
+        constexpr ~Watcher() {
+            if (valid()) ::close(m_descriptor);
+        }
+
+        //  PUBLIC METHODS  //
+
+        /// @brief Denotes if the watcher could be initialized.
+        inline constexpr bool valid() const noexcept { return m_descriptor >= 0; }
+
+        /// @brief Gets the pollable descriptor (for event-loop integration).
+        inline constexpr int descriptor() const noexcept { return m_descriptor; }
+
+        /// @brief Gets the currently matched entries.
+        inline constexpr const std::map<std::string, Archetype>& matched() const noexcept { return m_matched; }
+
+        /// @brief Gets the currently watched directories.
+        inline constexpr size_t watched() const noexcept { return m_directories.size(); }
+
+        /**
+         * @brief Waits for (and collects) any pending change events.
+         * @param timeout               Timeout in milliseconds (negative waits indefinitely).
+         */
+        inline constexpr std::vector<Event> poll(int timeout = 0) {
+            auto events = std::vector<Event>();
+            if (!valid()) return events;
+
+            // wait until the descriptor becomes readable
+            auto request = ::pollfd { .fd = m_descriptor, .events = POLLIN, .revents = 0 };
+            if (::poll(&request, 1, timeout) <= 0) return events;
+
+            // and drain all the available notifications now
+            alignas(::inotify_event) char buffer[64 * 1024];
+            for (ssize_t size; (size = ::read(m_descriptor, buffer, sizeof(buffer))) > 0;) {
+                m_process(std::span<const char>(buffer, size_t(size)), events);
+            }
+
+            // and return the collected events
+            return events;
+        }
+
+       private:
+        //  PRIVATE METHODS  //
+
+        /**
+         * @brief Processes a batch of raw notifications.
+         * @param buffer                Raw notification buffer.
+         * @param events                Outgoing events.
+         */
+        inline constexpr void m_process(std::span<const char> buffer, std::vector<Event>& events) {
+            auto moves = std::unordered_map<uint32_t, std::string>();  // pending renames (by cookie)
+
+            for (size_t offset = 0; offset < buffer.size();) {
+                auto event = reinterpret_cast<const ::inotify_event*>(buffer.data() + offset);
+                offset += sizeof(::inotify_event) + event->len;
+
+                // overflows lose events for unknown directories, so rescan everything
+                if (event->mask & IN_Q_OVERFLOW) {
+                    m_rescan(events), moves.clear();
+                    continue;
+                }
+
+                // resolve the directory that the event occurred in
+                auto found = m_watches.find(event->wd);
+                if (found == m_watches.end()) continue;
+
+                // the watch was removed by the kernel (eg: directory deleted)
+                if (event->mask & IN_IGNORED) {
+                    m_forget(found->second, event->wd);
+                    continue;
+                }
+
+                // a watched directory itself was removed
+                if (event->mask & IN_DELETE_SELF) {
+                    m_remove(std::string(found->second), events);
+                    continue;
+                }
+
+                // otherwise resolve the affected child path
+                auto path = Detail::join(found->second, event->name);
+                auto directory = bool(event->mask & IN_ISDIR);
+
+                if (event->mask & IN_MOVED_FROM) moves.insert_or_assign(event->cookie, path);
+                else if (event->mask & IN_DELETE) m_remove(path, events);
+                else if (event->mask & IN_CREATE) m_create(path, directory, events);
+                else if (event->mask & IN_MOVED_TO) {
+                    auto moved = moves.find(event->cookie);
+                    if (moved == moves.end()) m_create(path, directory, events);
+                    else m_rename(moved->second, path, directory, events), moves.erase(moved);
+                }
+            }
+
+            // any unpaired moves left the watched tree
+            for (const auto& [_, path] : moves) m_remove(path, events);
+        }
+
+        /**
+         * @brief Walks a directory (and any descendable sub-directories), watching and matching entries.
+         * @param directory             Directory to scan.
+         * @param events                Outgoing events (or null when silent).
+         */
+        inline constexpr void m_scan(const std::string& directory, std::vector<Event>* events) {
+            auto pending = std::vector<std::string>({ directory });
+
+            while (!pending.empty()) {
+                auto path = std::move(pending.back());
+                pending.pop_back();
+
+                // watch before listing so that concurrent changes are not missed
+                m_watch(path);
+
+                for (auto traversal = Detail::Traversal(path); !traversal.done();) {
+                    auto& entry = traversal.advance();
+                    if (entry.path.empty()) continue;
+
+                    // queue any sub-directories that could contain matches
+                    auto descend = entry.type == Archetype::DIRECTORY && m_filter.descends(entry.path);
+                    if (descend) pending.emplace_back(entry.path);
+
+                    // and record any matched entries
+                    if (m_filter.test(entry)) m_insert(entry, events);
+                }
+            }
+        }
+
+        /// @brief Rebuilds all watches and matches, emitting the differences.
+        inline constexpr void m_rescan(std::vector<Event>& events) {
+            auto previous = std::move(m_matched);
+            m_matched.clear();
+
+            // drop all existing watches
+            for (const auto& [descriptor, _] : m_watches) ::inotify_rm_watch(m_descriptor, descriptor);
+            m_watches.clear(), m_directories.clear();
+
+            // rescan silently and then diff the results
+            m_scan(m_options.cwd, nullptr);
+
+            for (const auto& [path, type] : m_matched) {
+                if (!previous.contains(path)) events.push_back({ Change::CREATED, Entry(path, type) });
+            }
+
+            for (const auto& [path, type] : previous) {
+                if (!m_matched.contains(path)) events.push_back({ Change::DELETED, Entry(path, type) });
+            }
+        }
+
+        /**
+         * @brief Handles a newly created (or moved in) path.
+         * @param path                  Created path.
+         * @param directory             Denotes a directory.
+         * @param events                Outgoing events.
+         */
+        inline constexpr void m_create(const std::string& path, bool directory, std::vector<Event>& events) {
+            auto entry = Entry(path, directory ? Archetype::DIRECTORY : m_archetype(path));
+            if (m_filter.test(entry)) m_insert(entry, &events);
+
+            // new directories need to be watched (and may already contain entries)
+            if (directory && m_filter.descends(path)) m_scan(path, &events);
+        }
+
+        /**
+         * @brief Handles a path renamed within the watched tree.
+         * @param from                  Previous path.
+         * @param to                    Current path.
+         * @param directory             Denotes a directory.
+         * @param events                Outgoing events.
+         */
+        inline constexpr void m_rename(
+            const std::string& from, const std::string& to, bool directory, std::vector<Event>& events) {
+            // directories are handled as a removal followed by a rescan of the new subtree
+            auto found = m_matched.find(from);
+            auto entry = Entry(to, directory ? Archetype::DIRECTORY : m_archetype(to));
+            if (directory || found == m_matched.end() || !m_filter.test(entry)) {
+                return m_remove(from, events), m_create(to, directory, events);
+            }
+
+            // otherwise both sides match so report a single rename
+            m_matched.erase(found), m_matched.insert_or_assign(to, entry.type);
+            events.push_back({ Change::RENAMED, entry, from });
+        }
+
+        /**
+         * @brief Records a matched entry.
+         * @param entry                 Entry to record.
+         * @param events                Outgoing events (or null when silent).
+         */
+        inline constexpr void m_insert(const Entry& entry, std::vector<Event>* events) {
+            auto inserted = m_matched.try_emplace(entry.path, entry.type).second;
+            if (inserted && events) events->push_back({ Change::CREATED, Entry(entry.path, entry.type) });
+        }
+
+        /**
+         * @brief Removes a path (and anything beneath it), emitting deletions.
+         * @param path                  Removed path.
+         * @param events                Outgoing events.
+         */
+        inline constexpr void m_remove(const std::string& path, std::vector<Event>& events) {
+            // remove the path itself
+            if (auto found = m_matched.find(path); found != m_matched.end()) {
+                events.push_back({ Change::DELETED, Entry(found->first, found->second) });
+                m_matched.erase(found);
+            }
+
+            // and then any matched descendants
+            auto prefix = Detail::join(path, "");
+            for (auto it = m_matched.lower_bound(prefix); it != m_matched.end() && it->first.starts_with(prefix);) {
+                events.push_back({ Change::DELETED, Entry(it->first, it->second) });
+                it = m_matched.erase(it);
+            }
+
+            // finally stop watching any removed directories
+            m_unwatch(path), m_unwatch(prefix);
+        }
+
+        /**
+         * @brief Watches a directory.
+         * @param path                  Directory to watch.
+         */
+        inline constexpr void m_watch(const std::string& path) {
+            auto descriptor = ::inotify_add_watch(m_descriptor, path.c_str(), s_events | IN_ONLYDIR);
+            if (descriptor < 0) return;  // unable to watch (eg: removed or no permissions)
+
+            // replace any stale mapping for the path
+            auto found = m_directories.find(path);
+            if (found != m_directories.end() && found->second != descriptor) m_watches.erase(found->second);
+
+            m_watches.insert_or_assign(descriptor, path);
+            m_directories.insert_or_assign(path, descriptor);
+        }
+
+        /**
+         * @brief Stops watching a directory (or all directories beneath a separator-terminated prefix).
+         * @param path                  Directory (or prefix) to stop watching.
+         */
+        inline constexpr void m_unwatch(const std::string& path) {
+            auto prefix = Detail::separator(path.back());
+            for (auto it = m_directories.lower_bound(path); it != m_directories.end();) {
+                if (prefix ? !it->first.starts_with(path) : it->first != path) break;
+                ::inotify_rm_watch(m_descriptor, it->second);
+                m_watches.erase(it->second), it = m_directories.erase(it);
+            }
+        }
+
+        /**
+         * @brief Forgets a watch that the kernel has already removed.
+         * @param path                  Watched directory.
+         * @param descriptor            Removed watch descriptor.
+         */
+        inline constexpr void m_forget(const std::string& path, int descriptor) {
+            auto found = m_directories.find(path);
+            if (found != m_directories.end() && found->second == descriptor) m_directories.erase(found);
+            m_watches.erase(descriptor);  // must be last since the path may be owned by the watch
+        }
+
+        /**
+         * @brief Gets the archetype of a path (without following symlinks).
+         * @param path                  Path to classify.
+         */
+        static inline constexpr Archetype m_archetype(const std::string& path) noexcept {
+            struct ::stat status = {};
+            if (::lstat(path.c_str(), &status) != 0) return Archetype::INVALID;
+            if (S_ISREG(status.st_mode)) return Archetype::REGULAR;
+            if (S_ISDIR(status.st_mode)) return Archetype::DIRECTORY;
+            if (S_ISLNK(status.st_mode)) return Archetype::SYMLINK;
+            return Archetype::INVALID;
+        }
+    };
+
+}  // namespace Aster
+
+#endif
+#endif
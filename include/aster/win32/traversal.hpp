@@ -1,8 +1,11 @@
 #ifndef _ASTER_TRAVERSAL_WIN32_HPP
 #define _ASTER_TRAVERSAL_WIN32_HPP
 
+/// C++ Includes
+#include <system_error>
+
 /// Aster Includes
-#include "aster/entry.hpp"
+#include "aster/listing.hpp"
 
 #ifdef _ASTER_PLATFORM_WIN32
 
@@ -21,18 +24,44 @@ namespace Aster::Detail {
         /// @brief File-handle reference.
         HANDLE m_stream = INVALID_HANDLE_VALUE;
 
+        /// @brief Failure opening the directory (if any).
+        std::error_code m_error = {};
+
         /// @brief The prefix directory value.
         std::string m_prefix = Detail::getcwd();
 
+        /// @brief Sorted listing (when buffered).
+        Listing m_listing = {};
+
+        /// @brief Denotes if entries are served from the listing.
+        bool m_buffered = false;
+
        public:
         //  CONSTRUCTORS  //
 
         /**
          * @brief Constructs a Win32 directory traverser.
          * @param prefix                Prefix directory.
+         * @param sorting               Listing sort order.
+         * @param buffered              Buffer the full listing upfront.
          */
-        constexpr explicit Traversal(const std::string& prefix = Detail::getcwd()) : m_prefix(prefix) {
+        constexpr explicit Traversal(
+            const std::string& prefix = Detail::getcwd(), Sorting sorting = Sorting::NONE, bool buffered = false) :
+            m_prefix(prefix) {
             m_stream = ::FindFirstFileA((m_prefix + "\\*").c_str(), &m_data);
+            if (m_stream == INVALID_HANDLE_VALUE) m_error = { int(::GetLastError()), std::system_category() };
+            if (buffered || sorting != Sorting::NONE) m_buffer(sorting);
+        }
+
+        /**
+         * @brief Constructs a traverser over a previously buffered listing.
+         * @param prefix                Prefix directory.
+         * @param listing               Listing to serve.
+         * @param sorting               Listing sort order.
+         */
+        constexpr Traversal(const std::string& prefix, Listing&& listing, Sorting sorting = Sorting::NONE) :
+            m_prefix(prefix), m_listing(std::move(listing)), m_buffered(true) {
+            m_listing.sort(sorting);
         }
 
         /// @brief Ensures we close a directory when necessary.
@@ -41,18 +70,27 @@ namespace Aster::Detail {
         //  PUBLIC METHODS  //
 
         /// @brief Denotes if currently done.
-        inline constexpr bool done() const noexcept { return m_stream == INVALID_HANDLE_VALUE; }
+        inline constexpr bool done() const noexcept { return m_stream == INVALID_HANDLE_VALUE && m_listing.empty(); }
+
+        /// @brief Gets the failure opening the directory (if any).
+        inline constexpr const std::error_code& error() const noexcept { return m_error; }
 
         /// @brief Gets the current iterator value.
         inline constexpr const Entry& current() const noexcept { return m_current; }
 
+        /// @brief Gets the buffered listing (empty unless buffered).
+        inline constexpr const Listing& listing() const noexcept { return m_listing; }
+
         /// @brief Advances the state of the traverser.
-        inline constexpr const Entry& advance() {
+        inline constexpr Entry& advance() {
+            // serve buffered listings directly
+            if (m_buffered) return m_current = m_listing.pop(), m_current;
+
             // stop if the file-handle is invalid
             if (m_stream == INVALID_HANDLE_VALUE) return m_current;
 
             // attempt checking for the next stream value now
-            do { m_current = m_classify(::FindNextFileA(m_stream, &m_data)); } while (m_ignored());
+            do { m_classify(::FindNextFileA(m_stream, &m_data)); } while (m_ignored());
 
             // remove the descriptor when complete
             if (m_current.path == "") m_release();
@@ -64,6 +102,15 @@ namespace Aster::Detail {
        private:
         //  PRIVATE METHODS  //
 
+        /**
+         * @brief Buffers the full directory listing in sorted order.
+         * @param sorting               Listing sort order.
+         */
+        inline constexpr void m_buffer(Sorting sorting) {
+            for (advance(); m_current.path.size(); advance()) m_listing.push(std::move(m_current));
+            m_listing.sort(sorting), m_buffered = true;
+        }
+
         /// @brief Handles releasing the stream.
         inline constexpr void m_release() {
             if (m_stream == INVALID_HANDLE_VALUE) return;  // ignore
@@ -83,15 +130,16 @@ namespace Aster::Detail {
          * @brief Handles classifying entries.
          * @param success               Found success.
          */
-        inline constexpr Entry m_classify(bool found) const noexcept {
+        inline constexpr void m_classify(bool found) {
             // failed to find valid match so we return as empty
-            if (!found) return {};
+            if (!found) return void(m_current = {});
 
-            std::string suffix = m_data.cFileName;  // prepare the path details
-            auto path = m_ignored(suffix) ? suffix : Detail::join(m_prefix, suffix);
+            std::string_view suffix = m_data.cFileName;  // prepare the path details
+            if (m_ignored(suffix)) return void(m_current.path.assign(suffix));
 
-            // and resolve the outgoing path to be used now
-            return { path, m_archetype() };
+            // and resolve the outgoing path into the reused buffer now
+            Detail::join(m_current.path, m_prefix, suffix);
+            m_current.type = m_archetype(), m_current.mask = 0;
         }
 
         /// @brief Gets the current associated archetype.
@@ -1,7 +1,59 @@
+/// C++ Includes
+#include <atomic>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
 /// Vendor Includes
 #include <aster/aster.hpp>
 #include <catch2/catch_all.hpp>
 
+//  TEST FIXTURES  //
+
+/// @brief Temporary Directory Tree.
+struct Fixture {
+    //  PROPERTIES  //
+
+    /// @brief The temporary root directory.
+    std::filesystem::path root = std::filesystem::temp_directory_path() / "aster-tests";
+
+    //  CONSTRUCTORS  //
+
+    /**
+     * @brief Constructs a temporary tree of empty files.
+     * @param files             Relative file paths.
+     */
+    Fixture(std::initializer_list<std::string_view> files) {
+        std::filesystem::remove_all(root);
+        for (const auto& file : files) {
+            auto path = root / file;  // ensure the parent directory exists first
+            std::filesystem::create_directories(path.parent_path());
+            std::ofstream(path).put('\n');
+        }
+    }
+
+    /// @brief Removes the temporary tree.
+    ~Fixture() { std::filesystem::remove_all(root); }
+
+    //  PUBLIC METHODS  //
+
+    /// @brief Gets walker options rooted at the fixture.
+    Aster::Options options() const {
+        auto options = Aster::Options();
+        return options.cwd = root.string(), options;
+    }
+};
+
 //  TEST CASES  //
 
 TEST_CASE("Glob::Match") {
@@ -138,6 +190,44 @@ TEST_CASE("Glob::Match") {
     }
 }
 
+TEST_CASE("Glob::Linear") {
+    // linear matching agrees with the backtracking matcher
+    auto cases = std::vector<std::pair<std::string, std::string>> {
+        { "**/*.cpp", "a/b/c.cpp" }, { "a/**/b", "a/b" }, { "a/**", "a" }, { "**/*/**", "a/b/c" },
+        { "{a,b}/*.{c,h}pp", "b/x.hpp" }, { "[!a-c]?", "dx" }, { "\\*x", "*x" }, { "!**/*.md", "a.md" },
+        { "a*b?c*x", "abxbbxdbxebxczzx" }, { "{a,{b,c}}/d", "c/d" }, { "{a/b,c}", "a/b" }, { "*", "a/b" },
+    };
+
+    for (const auto& [glob, input] : cases) CHECK(Aster::Match::linear(glob, input) == Aster::Match::glob(glob, input));
+    CHECK(!Aster::Match::linear("[ab", "a"));  // malformed globs never match
+    CHECK(!Aster::Match::linear("{a,b", "a"));
+
+    // adversarial globs stay linear (and still resolve correctly)
+    auto input = std::string(4096, 'a');
+    auto stars = std::string();
+    for (size_t index = 0; index < 64; ++index) stars += "a*";
+    CHECK(!Aster::Match::linear(stars + "b", input));
+    CHECK(Aster::Match::linear(stars, input));
+
+    auto braces = std::string();
+    for (size_t index = 0; index < 24; ++index) braces += "{a,aa,*}";
+    CHECK(Aster::Match::linear(braces, std::string(48, 'a')));
+    CHECK(!Aster::Match::linear(braces + "b", std::string(48, 'a')));
+
+    // complexity estimates expose expensive globs upfront
+    CHECK(Aster::Pattern("src/main.cpp").complexity() == 1);
+    CHECK(Aster::Pattern("**/*.cpp").complexity() == 1);
+    CHECK(Aster::Pattern("{a,b}{c,d}").complexity() == 4 * 11);
+    CHECK(Aster::Pattern("{a,{b,c}}").complexity() == 3 * 10);
+    CHECK(Aster::Pattern(braces).complexity() > size_t(1) << 32);
+
+    // which can then be matched in linear time
+    auto pattern = Aster::Pattern(braces, Aster::Matching::LINEAR);
+    CHECK(pattern.complexity() == braces.size() + 1);
+    CHECK(pattern.matches(std::string(30, 'a')));
+    CHECK(!Aster::Pattern("!{a,b}*", Aster::Matching::LINEAR).matches("ax"));
+}
+
 TEST_CASE("Glob::Walker") {
     BENCHMARK("Baseline") {
         auto walker = Aster::Walker("*.md");
@@ -155,6 +245,979 @@ TEST_CASE("Glob::Walker") {
     };
 }
 
+TEST_CASE("Glob::MultiWalker") {
+    auto fixture = Fixture({ "a.cpp", "a.hpp", "src/b.cpp", "src/c.proto", "docs/d.md" });
+    auto walker = Aster::MultiWalker({ "**/*.cpp", "**/*.{cpp,hpp}", "*.md", "src/*" });
+
+    // collect the masks for each matched relative path
+    auto masks = std::map<std::string, Aster::Mask>();
+    for (const auto& entry : walker.iterate(fixture.options())) {
+        masks[entry.path.substr(fixture.root.string().size() + 1)] = entry.mask;
+    }
+
+    CHECK(masks.size() == 4);
+    CHECK(masks["a.cpp"] == 0b0011);
+    CHECK(masks["a.hpp"] == 0b0010);
+    CHECK(masks["src/b.cpp"] == 0b1011);
+    CHECK(masks["src/c.proto"] == 0b1000);
+    CHECK(!masks.contains("docs/d.md"));
+}
+
+TEST_CASE("Glob::Visit") {
+    auto fixture = Fixture({ "a.cpp", "skip/b.cpp", "keep/c.cpp", "keep/d.cpp" });
+    auto options = fixture.options();
+    auto walker = Aster::Walker("**/*");
+
+    // a void visitor sees every match
+    size_t count = 0;
+    CHECK(walker.visit(options, [&](const Aster::Entry&) { count += 1; }));
+    CHECK(count == 4);
+
+    // stopping ends the walk immediately
+    count = 0;
+    CHECK(!walker.visit(options, [&](const Aster::Entry&) {
+        return ++count == 2 ? Aster::Visit::STOP : Aster::Visit::CONTINUE;
+    }));
+    CHECK(count == 2);
+
+    // skipping a directory prunes its contents
+    auto paths = std::set<std::string>();
+    options.directories = true;
+    CHECK(walker.visit(options, [&](const Aster::Entry& entry) {
+        paths.insert(entry.path.substr(options.cwd.size() + 1));
+        return entry.path.ends_with("skip") ? Aster::Visit::SKIP : Aster::Visit::CONTINUE;
+    }));
+    CHECK(paths == std::set<std::string> { "a.cpp", "skip", "keep", "keep/c.cpp", "keep/d.cpp" });
+
+    // whilst directories that never match are pruned before they are queued
+    auto sources = Aster::Walker("**/*.cpp");
+    options.directories = false, options.prune = [](std::string_view path) { return path.ends_with("skip"); };
+    paths.clear();
+    CHECK(sources.visit(options, [&](const Aster::Entry& entry) {
+        paths.insert(entry.path.substr(options.cwd.size() + 1));
+    }));
+    CHECK(paths == std::set<std::string> { "a.cpp", "keep/c.cpp", "keep/d.cpp" });
+}
+
+TEST_CASE("Glob::Queries") {
+    auto fixture = Fixture({ "a.proto", "src/b.proto", "src/c.cpp", "src/deep/d.proto" });
+    auto options = fixture.options();
+
+    // existence stops at the first match
+    CHECK(Aster::Walker("**/*.proto").exists(options));
+    CHECK_FALSE(Aster::Walker("**/*.rs").exists(options));
+
+    // counting tallies every match
+    CHECK(Aster::Walker("**/*.proto").count(options) == 3);
+    CHECK(Aster::Walker("*.proto").count(options) == 1);
+    CHECK(Aster::Walker("**/*.rs").count(options) == 0);
+
+    // collecting stops once enough entries were found
+    CHECK(Aster::Walker("**/*.proto").first(options, 2).size() == 2);
+    CHECK(Aster::Walker("**/*.proto").first(options, 8).size() == 3);
+    CHECK(Aster::Walker("**/*.proto").first(options, 0).empty());
+}
+
+TEST_CASE("Glob::Async") {
+    auto fixture = Fixture({ "a.cpp", "b.cpp", "src/c.cpp", "src/d.cpp", "src/deep/e.cpp" });
+    auto options = fixture.options();
+    auto walker = Aster::Walker("**/*.cpp");
+
+    // generators yield bounded batches lazily
+    auto sizes = std::vector<size_t>();
+    for (const auto& batch : walker.batches(options, 2)) sizes.emplace_back(batch.size());
+    CHECK(sizes == std::vector<size_t> { 2, 2, 1 });
+
+    // a minimal eagerly started coroutine task
+    struct Task {
+        struct promise_type {
+            Task get_return_object() noexcept { return {}; }
+            std::suspend_never initial_suspend() const noexcept { return {}; }
+            std::suspend_never final_suspend() const noexcept { return {}; }
+            void unhandled_exception() const noexcept { std::terminate(); }
+            void return_void() const noexcept {}
+        };
+    };
+
+    // streams defer all walking onto the executor
+    auto jobs = std::deque<std::function<void()>>();
+    auto stream = walker.stream(options, [&](auto job) { jobs.emplace_back(job); }, 2);
+
+    size_t count = 0, batches = 0;
+    auto drain = [&]() -> Task {
+        for (auto batch = co_await stream.next(); batch.size(); batch = co_await stream.next()) {
+            count += batch.size(), batches += 1;
+        }
+    };
+
+    drain();
+    CHECK(count == 0);
+
+    // and run the executor on a separate thread
+    std::thread([&] {
+        while (jobs.size()) {
+            auto job = std::move(jobs.front());
+            jobs.pop_front(), job();
+        }
+    }).join();
+
+    CHECK(count == 5);
+    CHECK(batches == 3);
+}
+
+TEST_CASE("Glob::Hidden") {
+    auto fixture = Fixture({ "a/b.txt", "a/.cache/c.txt", ".git/objects/d.txt", ".github/ci.yml", "a/.gitignore" });
+    auto options = fixture.options();
+
+    // collect the relative matches of a walk
+    auto walk = [&](const Aster::Pattern& pattern) {
+        auto paths = std::set<std::string>();
+        auto walker = Aster::Walker(pattern);
+        for (const auto& entry : walker.iterate(options)) {
+            paths.insert(entry.path.substr(options.cwd.size() + 1));
+        }
+
+        // and return the resulting matches
+        return paths;
+    };
+
+    // every hidden segment hides the entry
+    using Paths = std::set<std::string>;
+    CHECK(walk("**/*.txt") == Paths { "a/b.txt" });
+
+    // unless the pattern explicitly names it
+    CHECK(walk("**/.gitignore") == Paths { "a/.gitignore" });
+    CHECK(walk(".github/*.yml") == Paths { ".github/ci.yml" });
+    CHECK(walk("**/.cache/*.txt") == Paths { "a/.cache/c.txt" });
+
+    // hidden directories are never descended into
+    auto pattern = Aster::Pattern("**/*");
+    auto filter = Aster::Detail::Filter(std::span(&pattern, 1), options);
+    CHECK_FALSE(filter.descends(options.cwd + "/.git"));
+    CHECK(filter.descends(options.cwd + "/a"));
+
+    // and allowing hidden entries restores everything
+    options.hidden = true;
+    CHECK(walk("**/*.txt") == Paths { "a/b.txt", "a/.cache/c.txt", ".git/objects/d.txt" });
+}
+
+TEST_CASE("Glob::Pending") {
+    auto pending = Aster::Detail::Pending("/root");
+
+    // only names are stored, with full paths rebuilt on opening
+    CHECK(pending.pop() == "/root");
+    pending.push("/root/a"), pending.push("/root/b");
+    CHECK(pending.queued("/root/b"));
+    CHECK_FALSE(pending.queued("/root/a"));
+    CHECK(pending.pop() == "/root/b");
+
+    pending.push("/root/b/c");
+    CHECK(pending.pop() == "/root/b/c");
+    CHECK(pending.pop() == "/root/a");
+
+    // closing returns to the parent directory
+    pending.push("/root/a/d"), pending.drop();
+    pending.close(), pending.push("/root/e");
+    CHECK(pending.pop() == "/root/e");
+    CHECK(pending.empty());
+
+    // wide trees only keep each name once
+    constexpr size_t width = 100'000;
+    auto root = std::string("/a/reasonably/long/root/directory");
+    auto wide = Aster::Detail::Pending(root);
+    wide.pop();
+
+    for (size_t index = 0; index < width; ++index) wide.push(root + "/" + std::to_string(index));
+    CHECK(wide.size() == width);
+    CHECK(wide.bytes() * 2 < width * (sizeof(std::string) + root.size()));
+
+    BENCHMARK("Pending::push (wide)") {
+        auto queue = Aster::Detail::Pending("/root");
+        queue.pop();
+
+        for (size_t index = 0; index < width; ++index) queue.push("/root/" + std::to_string(index));
+        return queue.bytes();
+    };
+}
+
+TEST_CASE("Glob::Order") {
+    auto fixture = Fixture({ "a/b/c/deep.txt", "a/b/mid.txt", "a/top.txt", "root.txt", "z/high.txt" });
+    auto options = fixture.options();
+    auto walker = Aster::Walker("**/*.txt");
+
+    // collect the relative walk order
+    auto walk = [&]() {
+        auto paths = std::vector<std::string>();
+        walker.visit(options, [&](const Aster::Entry& entry) {
+            paths.emplace_back(entry.path.substr(options.cwd.size() + 1));
+        });
+
+        // and return the resulting order
+        return paths;
+    };
+
+    // breadth-first yields shallow matches first
+    options.order = Aster::Order::BREADTH;
+    auto depths = std::vector<size_t>();
+    for (const auto& path : walk()) depths.emplace_back(std::ranges::count(path, '/'));
+    CHECK(depths.size() == 5);
+    CHECK(std::ranges::is_sorted(depths));
+
+    // best-first opens the highest priority directories first
+    options.order = Aster::Order::PRIORITY;
+    options.priority = [](std::string_view path) { return path.ends_with("z") ? 1.0 : 0.0; };
+    CHECK(walk().at(1) == "z/high.txt");
+
+    // budgets cap the open handles whilst walking
+    auto budget = Aster::Budget(1);
+    options.order = Aster::Order::DEPTH, options.budget = &budget;
+    CHECK(walker.count(options) == 5);
+    CHECK(budget.used() == 0);
+}
+
+TEST_CASE("Glob::Errors") {
+    auto fixture = Fixture({ "a.txt", "gone/b.txt" });
+    auto options = fixture.options();
+    auto walker = Aster::Walker("**/*");
+    options.directories = true;
+
+    // (re)create the directory that goes missing
+    auto create = [&](const std::filesystem::path& path) {
+        std::filesystem::create_directories(path);
+        std::ofstream(path / "b.txt") << "b";
+    };
+
+    // remove the directory after it was queued (but before it is opened)
+    auto walk = [&]() {
+        create(fixture.root / "gone");
+
+        size_t count = 0;  // count the matched files
+        walker.visit(options, [&](const Aster::Entry& entry) {
+            if (entry.path.ends_with("gone")) std::filesystem::remove_all(entry.path);
+            count += entry.path.ends_with(".txt");
+        });
+
+        // and resolve the counted files
+        return count;
+    };
+
+    // failures are skipped silently by default
+    CHECK(walk() == 1);
+
+    // otherwise they are reported to the handler
+    auto failures = std::vector<std::error_code>();
+    options.error = [&](const std::string&, std::error_code error) {
+        return failures.emplace_back(error), Aster::Recovery::SKIP;
+    };
+
+    CHECK(walk() == 1);
+    CHECK(failures.size() == 1);
+    CHECK(failures.front() == std::errc::no_such_file_or_directory);
+
+    // which may retry opening the directory
+    failures.clear();
+    options.error = [&](const std::string& path, std::error_code error) {
+        return failures.emplace_back(error), create(path), Aster::Recovery::RETRY;
+    };
+
+    CHECK(walk() == 2);
+    CHECK(failures.size() == 1);
+
+    // or stop the walk altogether
+    options.error = [](const std::string&, std::error_code) { return Aster::Recovery::STOP; };
+    CHECK(walk() == 1);
+}
+
+TEST_CASE("Glob::Content") {
+    auto fixture = Fixture({ "a.txt", "src/b.txt", "src/c.txt", "src/d.bin", "empty.txt" });
+    auto options = fixture.options();
+    auto walker = Aster::Walker("**/*.txt");
+
+    // give each file its own name as content
+    for (auto name : { "a.txt", "src/b.txt", "src/c.txt" }) std::ofstream(fixture.root / name) << name;
+    std::ofstream(fixture.root / "empty.txt", std::ios::trunc);
+
+    // every matched file is read with its entry
+    auto contents = std::map<std::string, std::string>();
+    CHECK(walker.read(options, [&](const Aster::Entry& entry, std::string_view content) {
+        contents[entry.path.substr(options.cwd.size() + 1)] = content;
+    }, 2));
+
+    using Contents = std::map<std::string, std::string>;
+    CHECK(contents == Contents { { "a.txt", "a.txt" }, { "src/b.txt", "src/b.txt" }, { "src/c.txt", "src/c.txt" },
+                                 { "empty.txt", "" } });
+
+    // and stopping releases the remaining files
+    size_t count = 0;
+    CHECK_FALSE(walker.read(options, [&](const Aster::Entry&, std::string_view) {
+        return ++count == 2 ? Aster::Visit::STOP : Aster::Visit::CONTINUE;
+    }));
+    CHECK(count == 2);
+
+    // content may also be opened directly
+    auto content = Aster::Content((fixture.root / "a.txt").string());
+    auto moved = std::move(content);
+    CHECK(moved.view() == "a.txt");
+    CHECK(Aster::Content((fixture.root / "missing").string()).view().empty());
+}
+
+TEST_CASE("Glob::Backends") {
+    auto options = Aster::Options();
+    options.cwd = "/virtual";
+
+    // collect the relative matches of a walk
+    auto walk = [&](const Aster::Pattern& pattern, const auto& backend) {
+        auto paths = std::set<std::string>();
+        Aster::Walker(pattern).visit(options, [&](const Aster::Entry& entry) {
+            paths.insert(entry.path.substr(options.cwd.size() + 1));
+        }, backend);
+
+        // and return the resulting matches
+        return paths;
+    };
+
+    // in-memory trees are walked without touching the filesystem
+    using Paths = std::set<std::string>;
+    auto memory = Aster::Memory("/virtual", { "a.cpp", "src/b.cpp", "src/c.hpp", "src/deep/d.cpp", ".git/e.cpp" });
+    CHECK(walk("**/*.cpp", memory) == Paths { "a.cpp", "src/b.cpp", "src/deep/d.cpp" });
+    CHECK(walk("src/*", memory) == Paths { "src/b.cpp", "src/c.hpp" });
+    CHECK(Aster::Walker("**/*.hpp").count(options, memory) == 1);
+
+    options.directories = true, options.sorting = Aster::Sorting::BYTEWISE;
+    auto sorted = std::vector<std::string>();
+    auto walker = Aster::Walker("src/**");
+    for (const auto& entry : walker.iterate(options, memory)) sorted.emplace_back(entry.path);
+    CHECK(sorted == std::vector<std::string> { "/virtual/src/b.cpp", "/virtual/src/c.hpp", "/virtual/src/deep",
+                                               "/virtual/src/deep/d.cpp" });
+
+    // repeated paths keep their last type, and files gaining children become directories
+    auto repeated = Aster::Memory("/v", { "a.txt", "a.txt", "x" });
+    repeated.add("a.txt", Aster::Archetype::SYMLINK), repeated.add("x/y.txt");
+    auto listed = std::vector<std::pair<std::string, Aster::Archetype>>();
+    auto flattened = options;  // still listing directories in byte-wise order
+    auto everything = Aster::Walker("**");
+    flattened.cwd = repeated.root(), flattened.symlinks = true;
+    for (const auto& entry : everything.iterate(flattened, repeated)) listed.emplace_back(entry.path, entry.type);
+    CHECK(listed == std::vector<std::pair<std::string, Aster::Archetype>> {
+                        { "/v/a.txt", Aster::Archetype::SYMLINK },
+                        { "/v/x", Aster::Archetype::DIRECTORY },
+                        { "/v/x/y.txt", Aster::Archetype::REGULAR },
+                    });
+
+    // build a minimal ustar archive in memory
+    auto archive = std::string();
+    auto octal = [](size_t value, int width) {
+        char buffer[16] = {};
+        return std::snprintf(buffer, sizeof(buffer), "%0*zo", width, value), std::string(buffer);
+    };
+
+    auto append = [&](std::string name, char type, std::string body = "") {
+        auto header = std::string(512, '\0');
+        header.replace(0, name.size(), name), header[156] = type;
+        header.replace(124, 11, octal(body.size(), 11));
+        header.replace(257, 6, std::string("ustar\0", 6)), header.replace(148, 8, "        ");
+
+        // checksum the header (with its checksum field as spaces)
+        auto checksum = std::accumulate(header.begin(), header.end(), 0, [](int sum, char ch) {
+            return sum + uint8_t(ch);
+        });
+        header.replace(148, 7, octal(checksum, 6) + '\0');
+
+        // and pad the body out to whole blocks
+        archive += header + body + std::string((512 - body.size() % 512) % 512, '\0');
+    };
+
+    append("docs/", '5'), append("docs/a.md", '0', "# a"), append("src/b.cpp", '0', "int b;");
+    append("././@LongLink", 'L', std::string(120, 'x') + ".md"), append("replaced", '0');
+    archive += std::string(1024, '\0');
+
+    auto stream = std::istringstream(archive);
+    auto tar = Aster::Tar("/virtual", stream);
+    options.directories = false;
+    CHECK(walk("**/*.md", tar) == Paths { "docs/a.md", std::string(120, 'x') + ".md" });
+    CHECK(walk("**/*", tar).size() == 3);
+}
+
+TEST_CASE("Glob::Statistics") {
+    auto fixture = Fixture({ "a.cpp", "b.md", "src/c.cpp", "src/d.md", "docs/e.md" });
+    auto statistics = Aster::Statistics();
+    auto options = fixture.options();
+    options.statistics = &statistics;
+
+    // only "src" can contain matches, so "docs" is never opened
+    auto walker = Aster::Walker("src/*.cpp");
+    CHECK(walker.count(options) == 1);
+
+    // without instrumentation nothing is recorded (and the timers are empty)
+    if constexpr (!Aster::Statistics::enabled) {
+        CHECK(std::is_empty_v<Aster::Detail::Stopwatch>);
+        CHECK(statistics.opened == 0);
+        return;
+    }
+
+    CHECK(statistics.opened == 2);
+    CHECK(statistics.failed == 0);
+    CHECK(statistics.entries == 6);
+    CHECK(statistics.types[size_t(Aster::Archetype::DIRECTORY)] == 2);
+    CHECK(statistics.types[size_t(Aster::Archetype::REGULAR)] == 4);
+    CHECK(statistics.tested == 6);
+    CHECK(statistics.matched == 1);
+    CHECK(statistics.pruned == 1);
+    CHECK(statistics.pending == 1);
+    CHECK(statistics.bytes > 0);
+    CHECK(statistics.syscalls.count() > 0);
+    CHECK(statistics.matching.count() > 0);
+
+    // statistics accumulate across walks (including failed directories)
+    options.cwd = (fixture.root / "missing").string();
+    CHECK(walker.count(options) == 0);
+    CHECK(statistics.failed == 1);
+    CHECK(statistics.opened == 2);
+
+    // buffered (sorted) listings allocate every entry path, whereas streamed walks reuse a single path buffer
+    auto tree = Fixture({});
+    for (auto directory : { "first", "second", "third" }) {
+        std::filesystem::create_directories(tree.root / directory);
+        for (size_t index = 0; index < 20; ++index) {
+            std::ofstream(tree.root / directory / ("a-reasonably-long-file-name-" + std::to_string(index) + ".cpp"));
+        }
+    }
+
+    auto listed = uint64_t(0);
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(tree.root)) {
+        listed += entry.path().string().size() + 1;
+    }
+
+    auto measure = [&](Aster::Sorting sorting) {
+        auto measured = Aster::Statistics();
+        auto walk = tree.options();
+        walk.statistics = &measured, walk.sorting = sorting;
+        CHECK(Aster::Walker("**/*.cpp").count(walk) == 60);
+        return measured.bytes;
+    };
+
+    auto sorted = measure(Aster::Sorting::BYTEWISE), streamed = measure(Aster::Sorting::NONE);
+    CHECK(sorted >= listed);
+    CHECK(sorted <= listed * 3);
+    CHECK(streamed > 0);
+    CHECK(streamed * 4 < listed);
+}
+
+TEST_CASE("Glob::Cache") {
+    auto cache = Aster::Cache<Aster::Pattern>(4, 2);
+    auto compiles = size_t(0);
+    auto compile = [&](std::string_view glob) { return ++compiles, Aster::Pattern(glob); };
+
+    // repeated lookups share a single compiled pattern
+    auto first = cache.get("**/*.cpp", compile);
+    CHECK(cache.get("**/*.cpp", compile) == first);
+    CHECK(first->matches("src/a.cpp"));
+    CHECK(compiles == 1);
+    CHECK(cache.hits() == 1);
+    CHECK(cache.misses() == 1);
+
+    // the cache stays bounded (evicted patterns stay alive whilst shared)
+    for (auto glob : { "a", "b", "c", "d", "e", "f", "g", "h" }) cache.get(glob, compile);
+    CHECK(cache.size() <= cache.capacity());
+    CHECK(first->matches("src/b.cpp"));
+
+    // lookups are safe across threads
+    auto threads = std::vector<std::thread>();
+    for (size_t index = 0; index < 4; ++index) {
+        threads.emplace_back([&] {
+            for (size_t round = 0; round < 100; ++round) Aster::Pattern::cached("src/**/*.{c,h}pp");
+        });
+    }
+
+    for (auto& thread : threads) thread.join();
+    CHECK(Aster::Pattern::cached("src/**/*.{c,h}pp")->matches("src/deep/a.hpp"));
+    CHECK(Aster::Pattern::cache().hits() >= 397);
+
+    // and clearing drops every value (along with the counters)
+    cache.clear();
+    CHECK(cache.size() == 0);
+    CHECK(cache.hits() + cache.misses() == 0);
+}
+
+TEST_CASE("Glob::Captures") {
+    auto captured = [](std::string_view glob, std::string_view input) {
+        auto captures = Aster::Pattern(glob).match_captures(input);
+        auto spans = std::vector<std::string_view>();
+        for (size_t index = 0; index < captures.size(); ++index) spans.push_back(captures[index]);
+        return spans;
+    };
+
+    // each wildcard captures the span it matched
+    using Spans = std::vector<std::string_view>;
+    CHECK(captured("src/**/*.proto", "src/a/b/c.proto") == Spans{ "a/b", "c" });
+    CHECK(captured("src/**/*.proto", "src/c.proto") == Spans{ "", "c" });
+    CHECK(captured("?at/[a-c]*", "cat/banana") == Spans{ "c", "b", "anana" });
+    CHECK(captured("a*b*c", "axxbyybzc") == Spans{ "xx", "yybz" });
+    CHECK(captured("a/**/b/**/c", "a/x/b/y/z/c") == Spans{ "x", "y/z" });
+
+    // brace alternatives capture the taken alternative (wildcards in others are null)
+    CHECK(captured("*.{c,h}pp", "main.hpp") == Spans{ "main", "h" });
+    CHECK(captured("{foo,b*r}/*.md", "bazzr/r.md") == Spans{ "bazzr", "azz", "r" });
+    auto untaken = Aster::Pattern("{a*,b}/x").match_captures("b/x");
+    CHECK(untaken.size() == 2);
+    CHECK(untaken[0] == "b");
+    CHECK(untaken[1].data() == nullptr);
+
+    // captures spill beyond the inline capacity
+    CHECK(captured("*/*/*/*/*/*/*/*/*/*", "a/b/c/d/e/f/g/h/i/j").size() == 10);
+    CHECK(captured("*/*/*/*/*/*/*/*/*/*", "a/b/c/d/e/f/g/h/i/j")[9] == "j");
+
+    // and failed (or negated) matches capture nothing
+    CHECK(!Aster::Pattern("*.md").match_captures("a.cpp"));
+    CHECK(Aster::Pattern("!*.md").match_captures("a.cpp"));
+    CHECK(Aster::Pattern("!*.md").match_captures("a.cpp").size() == 0);
+}
+
+TEST_CASE("Glob::Optimizer") {
+    using Aster::Redundancy;
+    auto patterns = std::vector<Aster::Pattern>{
+        "**/*.log", "logs/**/*.log", "src/main.cpp", "src/*.cpp", "!**/*.tmp", "src/*.cpp", "!docs/**", "!.git/**",
+    };
+
+    // subsumption follows the slices (hidden segments must be named by both)
+    CHECK(Aster::Optimizer::subsumes("**/*.log", "logs/**/*.log"));
+    CHECK(Aster::Optimizer::subsumes("**/*.gz", "x/*.tar.gz"));
+    CHECK(Aster::Optimizer::subsumes("a/**/c", "a/c"));
+    CHECK(!Aster::Optimizer::subsumes("src/**", "src"));
+    CHECK(!Aster::Optimizer::subsumes("**", ".git/HEAD"));
+    CHECK(Aster::Optimizer::disjoint("**/*.log", "**/*.tmp"));
+    CHECK(!Aster::Optimizer::disjoint("**/*.gz", "**/*.tar.gz"));
+
+    // duplicates, covered and inert patterns are removed (reporting what made them redundant)
+    auto result = Aster::Optimizer::optimize(patterns);
+    CHECK(result.kept == std::vector<size_t>{ 0, 5, 6, 7 });
+    REQUIRE(result.removed.size() == 4);
+    CHECK((result.removed[0].index == 1 && result.removed[0].cause == 0));
+    CHECK(result.removed[0].reason == Redundancy::SUBSUMED);
+    CHECK((result.removed[1].index == 2 && result.removed[1].cause == 3));
+    CHECK(result.removed[1].reason == Redundancy::SHADOWED);
+    CHECK((result.removed[2].index == 3 && result.removed[2].cause == 5));
+    CHECK(result.removed[2].reason == Redundancy::DUPLICATE);
+    CHECK((result.removed[3].index == 4 && result.removed[3].reason == Redundancy::INERT));
+
+    // and the optimized list selects the same paths
+    for (auto path : { "a.log", "logs/x/a.log", "src/main.cpp", "a.tmp", "docs/a.log", ".git/a.log", "src/a.c" }) {
+        CHECK(Aster::Optimizer::selects(patterns, path) == Aster::Optimizer::selects(result.patterns, path));
+    }
+
+    // whilst negations between covering patterns are kept in place (since order matters)
+    auto ordered = std::vector<Aster::Pattern>{ "**/*.log", "!logs/**", "logs/**/*.log" };
+    CHECK(Aster::Optimizer::optimize(ordered).removed.empty());
+    CHECK(Aster::Optimizer::selects(ordered, "logs/a.log"));
+    CHECK(!Aster::Optimizer::selects(ordered, "logs/a.txt"));
+}
+
+TEST_CASE("Glob::Incremental") {
+    auto paths = std::vector<std::string_view>{
+        "build/a.o", "build/b.o", "build/deep/c.o", "src/a/b/c.proto", "src/a/b/d.proto", "src/a/e.txt", "src/f.proto",
+    };
+
+    // sorted paths match the same as whole paths (resuming from shared directories)
+    for (auto glob : { "src/**/*.proto", "src/a/**", "*/*.o", "**/b/*", "!build/**", "{src/a,build}/*" }) {
+        auto matcher = Aster::Incremental(glob);
+        for (auto path : paths) CHECK(matcher.matches(path) == Aster::Pattern(glob).matches(path));
+    }
+
+    auto matcher = Aster::Incremental("src/**/*.proto");
+    for (auto path : paths) matcher.matches(path);
+    CHECK(matcher.reused() > 0);
+
+    // directories that cannot contain matches are reported early
+    matcher.reset();
+    CHECK(!matcher.matches("build/a.o"));
+    CHECK(matcher.pruned() == "build/");
+    CHECK(matcher.skips("build/deep/c.o"));
+    CHECK(!matcher.skips("src/f.proto"));
+    CHECK(matcher.skip(paths, 1) == 3);
+
+    // so callers can skip ahead through sorted input
+    size_t count = 0;
+    for (size_t index = 0; index < paths.size(); index = matcher.skip(paths, index + 1)) {
+        count += matcher.matches(paths[index]);
+    }
+    CHECK(count == 3);
+}
+
+TEST_CASE("Glob::Parallel") {
+    auto fixture = Fixture({
+        "a.cpp", "b.md", "src/c.cpp", "src/deep/d.cpp", "src/deep/e.md", "docs/f.cpp", ".git/g.cpp",
+    });
+    auto options = fixture.options();
+    auto expected = std::set<std::string>();
+    Aster::Walker("**/*.cpp").visit(options, [&](const Aster::Entry& entry) { expected.insert(entry.path); });
+
+    // every match is consumed exactly once, whatever the number of workers
+    for (size_t threads : { 1, 2, 4, 0 }) {
+        auto mutex = std::mutex();
+        auto consumed = std::multiset<std::string>();
+        CHECK(Aster::Walker("**/*.cpp").parallel_for_each(options, [&](const Aster::Entry& entry) {
+            auto lock = std::scoped_lock(mutex);
+            consumed.insert(entry.path);
+        }, threads));
+        CHECK(consumed == std::multiset<std::string>(expected.begin(), expected.end()));
+    }
+
+    // multi-pattern walks keep their masks
+    auto masks = std::atomic<Aster::Mask>(0);
+    Aster::MultiWalker({ "**/*.cpp", "**/*.md" }).parallel_for_each(options, [&](const Aster::Entry& entry) {
+        masks |= entry.mask;
+    }, 2);
+    CHECK(masks == 0b11);
+
+    // stopping ends the walk early
+    auto visited = std::atomic<size_t>(0);
+    CHECK(!Aster::Walker("**/*").parallel_for_each(options, [&](const Aster::Entry&) {
+        return ++visited == 1 ? Aster::Visit::STOP : Aster::Visit::CONTINUE;
+    }, 2));
+    CHECK(visited >= 1);
+
+    // and consumer failures are rethrown once every worker finishes
+    CHECK_THROWS(Aster::Walker("**/*.cpp").parallel_for_each(options, [](const Aster::Entry&) {
+        throw std::runtime_error("failed");
+    }, 4));
+}
+
+TEST_CASE("Glob::Spanning") {
+    auto fixture = Fixture({ "a/b/x.txt", "a/b/c/z.txt", "a/b/c/deep/v.txt", "a/c/d/e.txt", "a/x/w.txt", "a/d.txt",
+                             "b/c/d.txt", "b/d/y.txt", "b/e.txt" });
+    auto options = fixture.options();
+
+    // every file matched by brute force (relative to the root)
+    auto expected = [&](const Aster::Pattern& pattern) {
+        auto paths = std::set<std::string>();
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(fixture.root)) {
+            auto path = entry.path().lexically_relative(fixture.root).generic_string();
+            if (entry.is_regular_file() && pattern.matches(path)) paths.insert(path);
+        }
+        return paths;
+    };
+
+    // braces spanning separators must never prune the directories they could match within
+    for (auto glob : { "{a,b/c}/*.txt", "a/{b,c/d}/*.txt", "{a/b,b/d}/*.txt", "a/{b/c,x}/**", "a/b{,/c}/**" }) {
+        auto walker = Aster::Walker(glob);
+        auto paths = std::set<std::string>();
+        for (const auto& entry : walker.iterate(options)) paths.insert(entry.path.substr(options.cwd.size() + 1));
+        CHECK(paths == expected(Aster::Pattern(glob)));
+        CHECK(paths.size());
+    }
+}
+
+#ifdef _ASTER_PLATFORM_UNIX
+TEST_CASE("Glob::Uring") {
+    auto fixture = Fixture({ "a.cpp", "src/b.cpp", "src/deep/c.cpp", "docs/d.md" });
+    auto options = fixture.options();
+
+    // untyped entries (as listed on filesystems lacking `d_type`) are resolved by their final segment
+    auto types = [&](const auto& resolver) {
+        auto entries = std::vector<Aster::Entry>();
+        for (auto name : { "a.cpp", "src", "missing", "docs" }) {
+            entries.emplace_back((fixture.root / name).string(), Aster::Archetype::INVALID);
+        }
+
+        auto untyped = std::vector<Aster::Entry*>();
+        for (auto& entry : entries) untyped.push_back(&entry);
+        auto directory = ::open(fixture.root.c_str(), O_RDONLY | O_DIRECTORY);
+        resolver(directory, untyped);
+        ::close(directory);
+
+        // and gather the resolved types
+        auto resolved = std::vector<Aster::Archetype>();
+        for (const auto& entry : entries) resolved.push_back(entry.type);
+        return resolved;
+    };
+
+    auto expected = std::vector<Aster::Archetype> { Aster::Archetype::REGULAR, Aster::Archetype::DIRECTORY,
+                                                    Aster::Archetype::INVALID, Aster::Archetype::DIRECTORY };
+    CHECK(types(Aster::Detail::resolve) == expected);
+
+#ifdef _ASTER_PLATFORM_URING
+    // rings resolve the same types with more requests than fit in flight at once
+    for (unsigned depth : { 1, 3, 64 }) {
+        auto ring = Aster::Detail::Ring(depth);
+        if (!ring.valid()) continue;  // io_uring may be unavailable or disallowed
+        CHECK(types([&](int directory, std::span<Aster::Entry* const> entries) {
+            CHECK(ring.resolve(directory, entries));
+        }) == expected);
+    }
+#endif
+
+    // and walks through the io_uring backend match the default backend (whether or not it is available)
+    for (unsigned depth : { 0, 1, 64 }) {
+        auto uring = Aster::Uring { depth };
+        CHECK(Aster::Walker("**/*.cpp").count(options, uring) == 3);
+        CHECK(Aster::Walker("src/*").count(options, uring) == 1);
+    }
+}
+#endif
+
+TEST_CASE("Glob::Manifest") {
+    auto fixture = Fixture({});
+    auto file = (fixture.root / "manifest.txt").string();
+    std::filesystem::create_directories(fixture.root);
+
+    // a manifest large enough to split across many chunks
+    auto expected = std::vector<std::string>();
+    {
+        auto output = std::ofstream(file, std::ios::binary);
+        for (size_t index = 0; index < 2000; ++index) {
+            auto path = "src/" + std::to_string(index) + (index % 3 ? ".md" : ".cpp");
+            if (index % 3 == 0) expected.push_back(path);
+            output << path << (index % 7 ? "\n" : "\r\n") << (index % 11 ? "" : "\n");
+        }
+    }
+
+    // matches stream in input order whatever the thread count
+    auto manifest = Aster::Manifest(file);
+    for (size_t threads : { 1, 2, 8 }) {
+        auto matches = std::vector<std::string>();
+        CHECK(manifest.filter("**/*.cpp", [&](std::string_view path) { matches.emplace_back(path); }, threads, 64)
+              == expected.size());
+        CHECK(matches == expected);
+    }
+
+    // sink failures stop the workers (and propagate)
+    auto failing = [](std::string_view path) {
+        if (path == "src/300.cpp") throw std::runtime_error("sink");
+    };
+    CHECK_THROWS(manifest.filter("**/*.cpp", failing, 4, 64));
+
+    // nul-delimited manifests (and streamed output) are supported too
+    std::ofstream(file, std::ios::binary).write("a.cpp\0b.md\0c/d.cpp\0e.md\r", 24);
+    auto output = std::ostringstream();
+    CHECK(Aster::Manifest(file, '\0').filter("**/*.cpp", output) == 2);
+    CHECK(output.str() == std::string("a.cpp\0c/d.cpp\0", 14));
+
+    // where carriage returns are valid filename characters
+    CHECK(Aster::Manifest(file, '\0').count("e.md\r") == 1);
+    CHECK(Aster::Manifest(file, '\0').count("e.md") == 0);
+    CHECK(Aster::Manifest((fixture.root / "missing").string()).count("**") == 0);
+}
+
+TEST_CASE("Glob::Tracing") {
+    auto fixture = Fixture({ "a.cpp", "b.md", "src/c.cpp", "src/d.cpp", "docs/e.md" });
+    auto traces = std::vector<Aster::Trace>();
+    auto options = fixture.options();
+    options.trace = [&](const Aster::Trace& trace) { traces.push_back(trace); };
+
+    // each opened directory is traced on opening and closing
+    CHECK(Aster::Walker("src/*.cpp").count(options) == 2);
+    REQUIRE(traces.size() == 4);
+    CHECK(traces[0].phase == Aster::Phase::OPEN);
+    CHECK(traces[1].phase == Aster::Phase::CLOSE);
+    CHECK(traces[1].path == traces[0].path);
+    CHECK(traces[1].entries == 4);
+    CHECK(traces[1].matches == 0);
+    CHECK(traces[1].reading.count() > 0);
+    CHECK(traces[2].phase == Aster::Phase::OPEN);
+    CHECK(traces[2].path.ends_with("src"));
+    CHECK(traces[3].phase == Aster::Phase::CLOSE);
+    CHECK(traces[3].entries == 2);
+    CHECK(traces[3].matches == 2);
+
+    // sorted walks nest directories (so the parent closes last)
+    traces.clear(), options.sorting = Aster::Sorting::BYTEWISE;
+    CHECK(Aster::Walker("src/*.cpp").count(options) == 2);
+    REQUIRE(traces.size() == 4);
+    CHECK(traces[1].path.ends_with("src"));
+    CHECK(traces[2].path.ends_with("src"));
+    CHECK(traces[3].path == traces[0].path);
+    CHECK(traces[3].entries == 4);
+
+    // stopping early closes every open directory
+    traces.clear();
+    Aster::Walker("**/*.cpp").visit(options, [](const Aster::Entry&) { return Aster::Visit::STOP; });
+    CHECK(traces.size() % 2 == 0);
+    CHECK(traces.back().phase == Aster::Phase::CLOSE);
+
+    // failed directories are traced with their error
+    traces.clear(), options.cwd = (fixture.root / "missing").string();
+    CHECK(Aster::Walker("**").count(options) == 0);
+    REQUIRE(traces.size() == 2);
+    CHECK(traces[1].error);
+
+    // and the exporter writes chrome trace-event json (complete events only)
+    auto stream = std::ostringstream();
+    {
+        auto chrome = Aster::Chrome(stream);
+        options = fixture.options(), options.trace = chrome.hook();
+        CHECK(Aster::Walker("**/*.cpp").count(options) == 3);
+    }
+
+    auto json = stream.str();
+    CHECK(json.starts_with("[\n{\"name\":"));
+    CHECK(json.ends_with("}\n]\n"));
+    CHECK(json.find("\"ph\":\"X\"") != std::string::npos);
+    CHECK(json.find("\"readdir_us\":") != std::string::npos);
+}
+
+TEST_CASE("Glob::Index") {
+    auto index = Aster::Index({ "src/a.cpp", "src/b.hpp", "src/deep/c.cpp", "docs/d.md", "a.cpp", "/abs/e.cpp" });
+    CHECK(index.size() == 6);
+
+    // collect the paths of a query
+    auto query = [&](const Aster::Pattern& pattern) {
+        auto paths = std::vector<std::string>();
+        for (const auto& entry : index.find(pattern)) paths.emplace_back(entry.path);
+        return paths;
+    };
+
+    // results stream in path order (without entering non-matching subtrees)
+    using Paths = std::vector<std::string>;
+    CHECK(query("**/*.cpp") == Paths { "/abs/e.cpp", "a.cpp", "src/a.cpp", "src/deep/c.cpp" });
+    CHECK(query("src/*") == Paths { "src/a.cpp", "src/b.hpp" });
+    CHECK(query("{docs,src}/*.{md,hpp}") == Paths { "docs/d.md", "src/b.hpp" });
+    CHECK(query("/abs/*.cpp") == Paths { "/abs/e.cpp" });
+    CHECK(query("!**/*.cpp") == Paths { "docs/d.md", "src/b.hpp" });
+    CHECK(index.count("src/deep") == 0);  // implied directories are not entries
+    CHECK(index.count("missing/**") == 0);
+
+    // stopping early ends the query
+    size_t visited = 0;
+    auto stop = [&](const Aster::Entry&) { return ++visited < 2 ? Aster::Visit::CONTINUE : Aster::Visit::STOP; };
+    CHECK_FALSE(index.query("**", stop));
+    CHECK(visited == 2);
+
+    // indexes can be built from a walk (relative to the working directory)
+    auto options = Aster::Options();
+    options.cwd = "/virtual", options.directories = true;
+    auto memory = Aster::Memory("/virtual", { "a.cpp", "src/b.cpp" });
+    auto walked = Aster::Index(Aster::Walker("**"), options, memory);
+    auto entries = walked.find("src{,/**}");
+    REQUIRE(entries.size() == 2);
+    CHECK(entries[0].path == "src");
+    CHECK(entries[0].type == Aster::Archetype::DIRECTORY);
+    CHECK(entries[1].path == "src/b.cpp");
+
+    // and queried concurrently
+    auto counts = std::vector<size_t>(4);
+    auto threads = std::vector<std::thread>();
+    for (auto& count : counts) threads.emplace_back([&] { count = index.count("**/*.cpp"); });
+    for (auto& thread : threads) thread.join();
+    CHECK(std::ranges::all_of(counts, [](size_t count) { return count == 4; }));
+}
+
+TEST_CASE("Glob::Sorting") {
+    auto fixture = Fixture({ "b/x2", "b/x10", "a.txt", "a/z", "a/y/1", "c" });
+
+    // collect the walk order for a given sorting mode
+    auto walk = [&](Aster::Sorting sorting) {
+        auto options = fixture.options();
+        options.sorting = sorting, options.directories = true;
+
+        auto paths = std::vector<std::string>();
+        auto walker = Aster::Walker("**/*");
+        for (const auto& entry : walker.iterate(options)) {
+            paths.emplace_back(entry.path.substr(options.cwd.size() + 1));
+        }
+
+        // and return the resulting order
+        return paths;
+    };
+
+    using Paths = std::vector<std::string>;
+    CHECK(walk(Aster::Sorting::BYTEWISE) == Paths { "a", "a/y", "a/y/1", "a/z", "a.txt", "b", "b/x10", "b/x2", "c" });
+    CHECK(walk(Aster::Sorting::NATURAL) == Paths { "a", "a/y", "a/y/1", "a/z", "a.txt", "b", "b/x2", "b/x10", "c" });
+
+    CHECK(Aster::Detail::natural("x2", "x10") < 0);
+    CHECK(Aster::Detail::natural("x010", "x10") == 0);
+    CHECK(Aster::Detail::natural("x10a", "x10b") < 0);
+}
+
+TEST_CASE("Glob::Snapshot") {
+    auto fixture = Fixture({ "a.cpp", "src/b.cpp", "src/c.hpp", "src/deep/d.cpp" });
+    auto file = (fixture.root / "snapshot.bin").string();
+    auto walker = Aster::Walker("**/*.cpp");
+
+    // collect the sorted walk for the given snapshot
+    auto walk = [&](Aster::Snapshot* snapshot) {
+        auto options = fixture.options();
+        options.snapshot = snapshot, options.sorting = Aster::Sorting::BYTEWISE;
+
+        auto paths = std::vector<std::string>();
+        for (const auto& entry : walker.iterate(options)) paths.emplace_back(entry.path);
+        return paths;
+    };
+
+    // record a fresh snapshot and persist it
+    auto recorded = Aster::Snapshot();
+    recorded.window(std::chrono::nanoseconds(0));
+    CHECK(walk(&recorded) == walk(nullptr));
+    CHECK(recorded.size() == 3);
+    CHECK(recorded.save(file));
+
+    // and ensure a reloaded snapshot reproduces the same walk
+    auto loaded = Aster::Snapshot(file);
+    CHECK(loaded.size() == 3);
+    CHECK(walk(&loaded) == walk(nullptr));
+
+    // records with out of range types are rejected (the final byte is the last records final type)
+    auto corrupt = (fixture.root / "corrupt.bin").string();
+    auto contents = std::string(std::istreambuf_iterator<char>(std::ifstream(file, std::ios::binary).rdbuf()), {});
+    contents.back() = char(0xFF);
+    std::ofstream(corrupt, std::ios::binary) << contents;
+    CHECK(Aster::Snapshot(corrupt).size() == 2);
+
+    // the root changed (by saving into it) whilst the unchanged sub-directories were reused
+    loaded.prune();
+    CHECK(loaded.size() == 2);
+
+    // modified directories must be re-read
+    std::ofstream(fixture.root / "src" / "e.cpp").put('\n');
+    CHECK(walk(&loaded).size() == 4);
+    CHECK(walk(&loaded) == walk(nullptr));
+}
+
+#ifdef _ASTER_PLATFORM_LINUX
+TEST_CASE("Glob::Watcher") {
+    auto fixture = Fixture({ "src/a.cpp", "src/a.hpp", "docs/b.md" });
+    auto watcher = Aster::Watcher("src/**/*.cpp", fixture.options());
+    auto src = fixture.root / "src";
+
+    // poll until the expected number of events arrive (or we time out)
+    auto poll = [&](size_t count) {
+        auto events = std::vector<Aster::Event>();
+        for (int attempt = 0; attempt < 20 && events.size() < count; ++attempt) {
+            for (auto& event : watcher.poll(50)) events.emplace_back(std::move(event));
+        }
+        return events;
+    };
+
+    REQUIRE(watcher.valid());
+    CHECK(watcher.matched().size() == 1);
+    CHECK(watcher.watched() == 2);  // "docs" can never match so is never watched
+
+    std::ofstream(src / "b.cpp").put('\n');
+    auto created = poll(1);
+    REQUIRE(created.size() == 1);
+    CHECK(created[0].change == Aster::Change::CREATED);
+    CHECK(created[0].entry.path == (src / "b.cpp").string());
+
+    std::filesystem::rename(src / "b.cpp", src / "c.cpp");
+    auto renamed = poll(1);
+    REQUIRE(renamed.size() == 1);
+    CHECK(renamed[0].change == Aster::Change::RENAMED);
+    CHECK(renamed[0].previous == (src / "b.cpp").string());
+
+    std::filesystem::create_directories(src / "deep");
+    std::ofstream(src / "deep" / "d.cpp").put('\n');
+    auto nested = poll(1);
+    REQUIRE(nested.size() == 1);
+    CHECK(nested[0].entry.path == (src / "deep" / "d.cpp").string());
+
+    std::filesystem::remove_all(src / "deep");
+    std::filesystem::remove(src / "c.cpp");
+    auto deleted = poll(2);
+    CHECK(deleted.size() == 2);
+    CHECK(watcher.matched().size() == 1);
+    CHECK(watcher.watched() == 2);
+}
+#endif
+
 TEST_CASE("Glob::Pattern") {
     std::string_view globstar = "**/*";  // prepare a fast-globstar
     std::string_view input = "some/small/or/large/path/to/a/needle.txt";
@@ -163,6 +1226,7 @@ TEST_CASE("Glob::Pattern") {
     // pre-ensure the glob and pattern match
     CHECK(Aster::Match::glob(globstar, input));
     CHECK(pattern.matches(input));
+    CHECK(!Aster::Pattern("*.txt").matches(input));
 
     // and then coordinate running benchmarks
     BENCHMARK("Match::glob") { return Aster::Match::glob(globstar, input); };